@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core/Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Nexus::Benchmark
+{
+    // Simple wall-clock timer for benchmark sections
+    class Timer
+    {
+    public:
+        Timer() : m_Start(std::chrono::high_resolution_clock::now()) {}
+
+        void Reset() { m_Start = std::chrono::high_resolution_clock::now(); }
+
+        double ElapsedMilliseconds() const
+        {
+            auto elapsed = std::chrono::high_resolution_clock::now() - m_Start;
+            return std::chrono::duration<double, std::milli>(elapsed).count();
+        }
+
+    private:
+        std::chrono::high_resolution_clock::time_point m_Start;
+    };
+
+    // Run a benchmark body several times and return the best time in milliseconds
+    template<typename Setup, typename Body>
+    double Measure(int repetitions, Setup&& setup, Body&& body)
+    {
+        double best = 0.0;
+        for (int i = 0; i < repetitions; i++)
+        {
+            setup();
+
+            Timer timer;
+            body();
+            double elapsed = timer.ElapsedMilliseconds();
+
+            if (i == 0 || elapsed < best)
+                best = elapsed;
+        }
+        return best;
+    }
+
+    // Print one result row: label, element count, total time and time per element
+    inline void Report(const std::string& label, size_t count, double milliseconds)
+    {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-40s %10zu  %10.3f ms  %8.2f ns/op",
+            label.c_str(), count, milliseconds, count ? milliseconds * 1.0e6 / count : 0.0);
+        NEXUS_INFO(line);
+    }
+
+#if defined(_MSC_VER)
+    // Publishing the address makes the value escape; MSVC has no inline assembly on x64
+    inline const void* volatile g_Sink = nullptr;
+#endif
+
+    // Prevent the optimizer from discarding a computed result
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        g_Sink = &value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "g"(&value) : "memory");
+#endif
+    }
+
+    // Benchmark suites
+    void RunComponentStorageBenchmarks();
+    void RunSortBenchmarks();
+    void RunTagBenchmarks();
+    void RunArchetypeBenchmarks();
+    void RunJobSystemBenchmarks();
+    void RunParallelViewBenchmarks();
+    void RunSpawnBenchmarks();
+    void RunSnapshotBenchmarks();
+    void RunAllocatorBenchmarks();
+    void RunNameLookupBenchmarks();
+    void RunRollbackBenchmarks();
+    void RunHierarchyBenchmarks();
+}
@@ -0,0 +1,80 @@
+#include "Benchmark.h"
+#include "Core/MemoryArena.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include <memory>
+
+namespace Nexus::Benchmark
+{
+    // Trivially copyable per-prop gameplay data
+    struct LevelProp
+    {
+        float bounds[6] = {};
+        uint32_t flags = 0;
+    };
+
+    // Level load as a loader would do it: entity by entity, storages grow as they go
+    static void LoadLevel(Registry& registry, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Entity entity = registry.CreateEntity();
+            registry.AddComponent<Transform>(entity, Vector3(float(i), 0.0f, 0.0f));
+            registry.AddComponent<MeshRenderer>(entity, uint32_t(i % 64), uint32_t(i % 16));
+            registry.AddComponent<LevelProp>(entity);
+        }
+    }
+
+    void RunAllocatorBenchmarks()
+    {
+        NEXUS_INFO("--- Level load/unload: global heap vs arena ---");
+
+        MemoryArena arena(512ull * 1024 * 1024);
+
+        for (size_t count : { size_t(100000), size_t(500000) })
+        {
+            std::unique_ptr<Registry> registry;
+
+            double heapLoad = Measure(5, [&]() { registry = std::make_unique<Registry>(); },
+                [&]() { LoadLevel(*registry, count); });
+            Report("load (heap)", count, heapLoad);
+
+            double heapUnload = Measure(5,
+                [&]()
+                {
+                    registry = std::make_unique<Registry>();
+                    LoadLevel(*registry, count);
+                },
+                [&]() { registry.reset(); });
+            Report("unload (heap)", count, heapUnload);
+
+            double arenaLoad = Measure(5,
+                [&]()
+                {
+                    registry.reset();
+                    arena.Reset();
+                    registry = std::make_unique<Registry>(&arena);
+                },
+                [&]() { LoadLevel(*registry, count); });
+            Report("load (arena)", count, arenaLoad);
+
+            double arenaUnload = Measure(5,
+                [&]()
+                {
+                    registry.reset();
+                    arena.Reset();
+                    registry = std::make_unique<Registry>(&arena);
+                    LoadLevel(*registry, count);
+                },
+                [&]()
+                {
+                    registry.reset();
+                    arena.Reset();
+                });
+            Report("unload (arena)", count, arenaUnload);
+
+            NEXUS_INFO("arena peak: " + std::to_string(arena.GetPeak() / (1024 * 1024)) + " MiB");
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include "Benchmark.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/ArchetypeRegistry.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include "Scene/ECS/Components/Light.h"
+
+namespace Nexus::Benchmark
+{
+    // Populate either registry type with the same scene: every entity has a Transform,
+    // half have a MeshRenderer and a quarter have MeshRenderer + Light
+    template<EntityRegistry TRegistry>
+    static void PopulateScene(TRegistry& registry, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            auto entity = registry.CreateEntity();
+            registry.template AddComponent<Transform>(entity, Vector3(float(i), 0.0f, 0.0f));
+
+            if (i % 2 == 0)
+                registry.template AddComponent<MeshRenderer>(entity, uint32_t(i), uint32_t(i % 16));
+            if (i % 4 == 0)
+                registry.template AddComponent<Light>(entity);
+        }
+    }
+
+    template<EntityRegistry TRegistry>
+    static void RunIterationBackend(const char* backendName, size_t count)
+    {
+        TRegistry registry;
+
+        Timer populateTimer;
+        PopulateScene(registry, count);
+        Report(std::string(backendName) + " populate", count, populateTimer.ElapsedMilliseconds());
+
+        double transformTime = Measure(10, []() {},
+            [&]()
+            {
+                float sum = 0.0f;
+                registry.template View<Transform>().ForEach(
+                    [&](auto, Transform& transform) { sum += transform.position.x; });
+                DoNotOptimize(sum);
+            });
+        Report(std::string(backendName) + " iterate Transform", count, transformTime);
+
+        double litTime = Measure(10, []() {},
+            [&]()
+            {
+                float sum = 0.0f;
+                registry.template View<Transform, MeshRenderer, Light>().ForEach(
+                    [&](auto, Transform& transform, MeshRenderer& mesh, Light& light)
+                    {
+                        sum += transform.position.x * light.intensity + float(mesh.materialID);
+                    });
+                DoNotOptimize(sum);
+            });
+        Report(std::string(backendName) + " iterate Transform+Mesh+Light", count / 4, litTime);
+    }
+
+    // Transform+MeshRenderer through a view (sparse lookups) and through an owning group
+    static void RunGroupIteration(size_t count)
+    {
+        Registry registry;
+        PopulateScene(registry, count);
+
+        double viewTime = Measure(10, []() {},
+            [&]()
+            {
+                float sum = 0.0f;
+                registry.View<const Transform, const MeshRenderer>().ForEach(
+                    [&](Entity, const Transform& transform, const MeshRenderer& mesh) { sum += transform.position.x + float(mesh.materialID); });
+                DoNotOptimize(sum);
+            });
+        Report("sparse view Transform+Mesh", count / 2, viewTime);
+
+        const auto& group = registry.Group<Transform, MeshRenderer>();
+        double groupTime = Measure(10, []() {},
+            [&]()
+            {
+                float sum = 0.0f;
+                group.ForEach([&](Entity, const Transform& transform, const MeshRenderer& mesh) { sum += transform.position.x + float(mesh.materialID); });
+                DoNotOptimize(sum);
+            });
+        Report("sparse group Transform+Mesh", count / 2, groupTime);
+    }
+
+    void RunArchetypeBenchmarks()
+    {
+        NEXUS_INFO("--- Iteration: sparse-set Registry vs ArchetypeRegistry ---");
+
+        for (size_t count : { size_t(100000), size_t(500000) })
+        {
+            RunIterationBackend<Registry>("sparse", count);
+            RunIterationBackend<ArchetypeRegistry>("archetype", count);
+            RunGroupIteration(count);
+        }
+    }
+}
@@ -0,0 +1,221 @@
+#include "Benchmark.h"
+#include "Scene/ECS/Component.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include "Scene/ECS/Components/Tags.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+namespace Nexus::Benchmark
+{
+    // The original hash-map backed storage, kept here as the baseline for comparison
+    template<typename T>
+    class HashedComponentStorage
+    {
+    public:
+        T& AddComponent(EntityID entity)
+        {
+            auto it = m_EntityToIndex.find(entity);
+            if (it != m_EntityToIndex.end())
+                return m_Components[it->second];
+
+            size_t index = m_Components.size();
+            m_Components.emplace_back();
+            m_Entities.push_back(entity);
+            m_EntityToIndex[entity] = index;
+            return m_Components.back();
+        }
+
+        T& GetComponent(EntityID entity)
+        {
+            return m_Components[m_EntityToIndex.find(entity)->second];
+        }
+
+        void RemoveComponent(EntityID entity)
+        {
+            auto it = m_EntityToIndex.find(entity);
+            if (it == m_EntityToIndex.end())
+                return;
+
+            size_t indexToRemove = it->second;
+            size_t lastIndex = m_Components.size() - 1;
+            if (indexToRemove != lastIndex)
+            {
+                m_Components[indexToRemove] = std::move(m_Components[lastIndex]);
+                m_Entities[indexToRemove] = m_Entities[lastIndex];
+                m_EntityToIndex[m_Entities[indexToRemove]] = indexToRemove;
+            }
+
+            m_Components.pop_back();
+            m_Entities.pop_back();
+            m_EntityToIndex.erase(entity);
+        }
+
+    private:
+        std::vector<T> m_Components;
+        std::vector<EntityID> m_Entities;
+        std::unordered_map<EntityID, size_t> m_EntityToIndex;
+    };
+
+    // Representative 64-byte component payload
+    struct BenchComponent
+    {
+        float values[16] = {};
+    };
+
+    template<typename Storage>
+    static void RunStorageBackend(const char* backendName, const std::vector<EntityID>& entities,
+        const std::vector<EntityID>& lookupOrder)
+    {
+        const size_t count = entities.size();
+        const int repetitions = count >= 1000000 ? 3 : 5;
+        std::unique_ptr<Storage> storage;
+
+        double addTime = Measure(repetitions,
+            [&]() { storage = std::make_unique<Storage>(); },
+            [&]()
+            {
+                for (EntityID entity : entities)
+                    storage->AddComponent(entity);
+            });
+        Report(std::string(backendName) + " add", count, addTime);
+
+        double getTime = Measure(repetitions,
+            []() {},
+            [&]()
+            {
+                float sum = 0.0f;
+                for (EntityID entity : lookupOrder)
+                    sum += storage->GetComponent(entity).values[0];
+                DoNotOptimize(sum);
+            });
+        Report(std::string(backendName) + " random get", count, getTime);
+
+        double removeTime = Measure(repetitions,
+            [&]()
+            {
+                storage = std::make_unique<Storage>();
+                for (EntityID entity : entities)
+                    storage->AddComponent(entity);
+            },
+            [&]()
+            {
+                for (EntityID entity : lookupOrder)
+                    storage->RemoveComponent(entity);
+            });
+        Report(std::string(backendName) + " remove", count, removeTime);
+    }
+
+    void RunComponentStorageBenchmarks()
+    {
+        NEXUS_INFO("--- ComponentStorage: hashed vs paged sparse set ---");
+
+        for (size_t count : { size_t(10000), size_t(100000), size_t(1000000) })
+        {
+            // Entity IDs are dense in practice (1..N, with recycling)
+            std::vector<EntityID> entities(count);
+            std::iota(entities.begin(), entities.end(), EntityID(1));
+
+            std::vector<EntityID> lookupOrder = entities;
+            std::shuffle(lookupOrder.begin(), lookupOrder.end(), std::mt19937(1234));
+
+            RunStorageBackend<HashedComponentStorage<BenchComponent>>("hashed", entities, lookupOrder);
+            RunStorageBackend<ComponentStorage<BenchComponent>>("sparse", entities, lookupOrder);
+        }
+    }
+
+    void RunSortBenchmarks()
+    {
+        NEXUS_INFO("--- ComponentStorage sort by material ---");
+
+        const size_t count = 100000;
+        auto byMaterial = [](const MeshRenderer& a, const MeshRenderer& b) { return a.materialID < b.materialID; };
+
+        std::mt19937 random(42);
+        std::unique_ptr<ComponentStorage<MeshRenderer>> storage;
+
+        double fullTime = Measure(5,
+            [&]()
+            {
+                storage = std::make_unique<ComponentStorage<MeshRenderer>>();
+                for (EntityID entity = 1; entity <= count; entity++)
+                    storage->AddComponent(entity, uint32_t(entity), uint32_t(random() % 256));
+            },
+            [&]() { storage->Sort(byMaterial); });
+        Report("full sort (random)", count, fullTime);
+
+        // Nudge 1% of the keys by one step (like view depth drifting between frames), then re-sort
+        auto perturb = [&]()
+        {
+            storage->Sort(byMaterial);
+            for (size_t i = 0; i < count / 100; i++)
+            {
+                uint32_t& key = storage->GetComponents()[random() % count].materialID;
+                key = (random() % 2 && key > 0) ? key - 1 : key + 1;
+            }
+        };
+
+        double resortFullTime = Measure(5, perturb, [&]() { storage->Sort(byMaterial); });
+        Report("re-sort 1% nudged (default)", count, resortFullTime);
+
+        double resortInsertionTime = Measure(5, perturb, [&]() { storage->Sort(byMaterial, SortAlgorithm::Insertion); });
+        Report("re-sort 1% nudged (insertion)", count, resortInsertionTime);
+    }
+
+    // One-byte marker stored like any other component, for comparison with tag storage
+    struct HiddenFlag
+    {
+        uint8_t value = 1;
+    };
+
+    template<typename Storage>
+    void RunTagBackend(const std::string& name, const std::vector<EntityID>& entities, const std::vector<EntityID>& lookupOrder)
+    {
+        std::unique_ptr<Storage> storage;
+        auto fill = [&]()
+        {
+            storage = std::make_unique<Storage>();
+            for (size_t i = 0; i < entities.size(); i += 2)
+                storage->AddComponent(entities[i]);
+        };
+
+        double hasTime = Measure(5, fill, [&]()
+            {
+                size_t found = 0;
+                for (EntityID entity : lookupOrder)
+                    found += storage->HasComponent(entity);
+                DoNotOptimize(found);
+            });
+        Report(name + " has (random, 50% tagged)", lookupOrder.size(), hasTime);
+
+        double churnTime = Measure(5, fill, [&]()
+            {
+                for (size_t i = 0; i < entities.size(); i += 2)
+                    storage->RemoveComponent(entities[i]);
+                for (size_t i = 1; i < entities.size(); i += 2)
+                    storage->AddComponent(entities[i]);
+            });
+        Report(name + " remove + add", entities.size(), churnTime);
+
+        StorageMemoryStats stats = storage->GetMemoryStats();
+        NEXUS_INFO(name + " memory: " + std::to_string(stats.GetTotalBytes()) + " bytes");
+    }
+
+    void RunTagBenchmarks()
+    {
+        NEXUS_INFO("--- Tag components: bitset vs sparse set ---");
+
+        const size_t count = 1000000;
+        std::vector<EntityID> entities(count);
+        std::iota(entities.begin(), entities.end(), EntityID(1));
+
+        std::vector<EntityID> lookupOrder = entities;
+        std::shuffle(lookupOrder.begin(), lookupOrder.end(), std::mt19937(1234));
+
+        RunTagBackend<ComponentStorage<HiddenFlag>>("sparse", entities, lookupOrder);
+        RunTagBackend<ComponentStorage<Hidden>>("tag", entities, lookupOrder);
+    }
+}
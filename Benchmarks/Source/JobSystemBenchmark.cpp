@@ -0,0 +1,120 @@
+#include "Benchmark.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nexus::Benchmark
+{
+    // Synthetic CPU work that cannot be folded away
+    static float SpinWork(uint32_t seed, int iterations)
+    {
+        float value = float(seed);
+        for (int i = 0; i < iterations; i++)
+        {
+            value = std::sqrt(value * 1.0001f + 1.0f);
+        }
+        return value;
+    }
+
+    // Thread counts to test: 1, 2, 4, ... up to the hardware thread count
+    static std::vector<uint32_t> GetThreadCounts()
+    {
+        uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        std::vector<uint32_t> counts;
+        for (uint32_t threads = 1; threads < hardwareThreads; threads *= 2)
+        {
+            counts.push_back(threads);
+        }
+        counts.push_back(hardwareThreads);
+        return counts;
+    }
+
+    struct ForkJoinContext
+    {
+        JobSystem* jobs;
+        std::atomic<uint32_t>* checksum;
+        uint32_t leavesPerBranch;
+        int workPerLeaf;
+    };
+
+    // Two-level fork/join graph: the root forks branches, each branch forks and joins its leaves
+    static void RunForkJoin(ForkJoinContext& context, uint32_t branchCount)
+    {
+        JobCounter branches;
+        ForkJoinContext* ctx = &context;
+
+        for (uint32_t branch = 0; branch < branchCount; branch++)
+        {
+            context.jobs->Run([ctx, branch]()
+                {
+                    JobCounter leaves;
+                    for (uint32_t leaf = 0; leaf < ctx->leavesPerBranch; leaf++)
+                    {
+                        uint32_t seed = branch * ctx->leavesPerBranch + leaf;
+                        ctx->jobs->Run([ctx, seed]()
+                            {
+                                float value = SpinWork(seed, ctx->workPerLeaf);
+                                ctx->checksum->fetch_add(uint32_t(value), std::memory_order_relaxed);
+                            }, &leaves);
+                    }
+                    ctx->jobs->Wait(leaves);
+                }, &branches);
+        }
+
+        context.jobs->Wait(branches);
+    }
+
+    void RunJobSystemBenchmarks()
+    {
+        NEXUS_INFO("--- JobSystem: fork/join scaling ---");
+
+        const uint32_t branchCount = 64;
+        const uint32_t leavesPerBranch = 64;
+        const uint32_t tinyJobCount = 10000;
+        const size_t parallelForCount = 1000000;
+
+        for (uint32_t threads : GetThreadCounts())
+        {
+            JobSystem jobs(threads - 1);
+            std::atomic<uint32_t> checksum{ 0 };
+            std::string suffix = " (" + std::to_string(threads) + " threads)";
+
+            // Fork/join graph with moderate work per leaf
+            ForkJoinContext context{ &jobs, &checksum, leavesPerBranch, 2000 };
+            double forkJoinTime = Measure(5, []() {}, [&]() { RunForkJoin(context, branchCount); });
+            Report("fork/join 64x64" + suffix, branchCount * leavesPerBranch, forkJoinTime);
+
+            // Many tiny jobs: measures scheduling overhead per job
+            double tinyTime = Measure(5, []() {},
+                [&]()
+                {
+                    JobCounter counter;
+                    std::atomic<uint32_t>* sum = &checksum;
+                    for (uint32_t i = 0; i < tinyJobCount; i++)
+                    {
+                        jobs.Run([sum]() { sum->fetch_add(1, std::memory_order_relaxed); }, &counter);
+                    }
+                    jobs.Wait(counter);
+                });
+            Report("tiny jobs" + suffix, tinyJobCount, tinyTime);
+
+            // Data-parallel loop
+            std::vector<float> values(parallelForCount, 1.0f);
+            double parallelForTime = Measure(5, []() {},
+                [&]()
+                {
+                    jobs.ParallelFor(values.size(), 4096, [&](size_t begin, size_t end)
+                        {
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                values[i] = SpinWork(uint32_t(i), 8);
+                            }
+                        });
+                });
+            Report("ParallelFor" + suffix, parallelForCount, parallelForTime);
+
+            DoNotOptimize(checksum.load());
+        }
+    }
+}
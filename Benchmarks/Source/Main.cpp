@@ -0,0 +1,22 @@
+#include "Benchmark.h"
+
+int main()
+{
+    NEXUS_INFO("=== NexusEngine Benchmarks ===");
+
+    Nexus::Benchmark::RunComponentStorageBenchmarks();
+    Nexus::Benchmark::RunSortBenchmarks();
+    Nexus::Benchmark::RunTagBenchmarks();
+    Nexus::Benchmark::RunArchetypeBenchmarks();
+    Nexus::Benchmark::RunJobSystemBenchmarks();
+    Nexus::Benchmark::RunParallelViewBenchmarks();
+    Nexus::Benchmark::RunSpawnBenchmarks();
+    Nexus::Benchmark::RunSnapshotBenchmarks();
+    Nexus::Benchmark::RunAllocatorBenchmarks();
+    Nexus::Benchmark::RunNameLookupBenchmarks();
+    Nexus::Benchmark::RunRollbackBenchmarks();
+    Nexus::Benchmark::RunHierarchyBenchmarks();
+
+    NEXUS_INFO("=== Benchmarks Complete ===");
+    return 0;
+}
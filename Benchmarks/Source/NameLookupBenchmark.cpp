@@ -0,0 +1,66 @@
+#include "Benchmark.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Components/Name.h"
+#include <string>
+#include <vector>
+
+namespace Nexus::Benchmark
+{
+    void RunNameLookupBenchmarks()
+    {
+        NEXUS_INFO("--- Find entity by name: view scan vs name index ---");
+
+        const size_t count = 100000;
+        const size_t lookups = 1000;
+
+        Registry registry;
+        std::vector<Entity> entities(count);
+        registry.CreateEntities(count, entities);
+        for (size_t i = 0; i < count; i++)
+            registry.AddComponent<Name>(entities[i], "Prop_" + std::to_string(i));
+
+        std::vector<std::string> queries;
+        for (size_t i = 0; i < lookups; i++)
+            queries.push_back("Prop_" + std::to_string((i * 7919) % count));
+
+        double scanTime = Measure(3, []() {}, [&]()
+            {
+                size_t found = 0;
+                for (const std::string& query : queries)
+                {
+                    for (auto [entity, name] : registry.View<const Name>())
+                    {
+                        if (name.GetString() == query)
+                        {
+                            found++;
+                            break;
+                        }
+                    }
+                }
+                DoNotOptimize(found);
+            });
+        Report("view scan (string compare)", lookups, scanTime);
+
+        double indexTime = Measure(5, []() {}, [&]()
+            {
+                size_t found = 0;
+                for (const std::string& query : queries)
+                    found += registry.FindEntityByName(query).IsValid();
+                DoNotOptimize(found);
+            });
+        Report("name index (string query)", lookups, indexTime);
+
+        std::vector<StringID> interned;
+        for (const std::string& query : queries)
+            interned.emplace_back(query);
+
+        double handleTime = Measure(5, []() {}, [&]()
+            {
+                size_t found = 0;
+                for (StringID query : interned)
+                    found += registry.FindEntityByName(query).IsValid();
+                DoNotOptimize(found);
+            });
+        Report("name index (interned handle)", lookups, handleTime);
+    }
+}
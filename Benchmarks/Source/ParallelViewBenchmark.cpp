@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+#include "Core/JobSystem.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+
+namespace Nexus::Benchmark
+{
+    void RunParallelViewBenchmarks()
+    {
+        NEXUS_INFO("--- View::ParallelForEach scaling ---");
+
+        const size_t entityCount = 300000;
+
+        Registry registry;
+        for (size_t i = 0; i < entityCount; i++)
+        {
+            Entity entity = registry.CreateEntity();
+            registry.AddComponent<Transform>(entity, Vector3(float(i), 0.0f, 0.0f));
+            if (i % 2 == 0)
+                registry.AddComponent<MeshRenderer>(entity, uint32_t(i), uint32_t(i % 16));
+        }
+
+        Vector3 step(0.0f, 0.01f, 0.0f);
+
+        // Transform update: move and rebuild the local matrix
+        double serialTime = Measure(5, []() {},
+            [&]()
+            {
+                registry.View<Transform>().ForEach([&](Entity, Transform& transform)
+                    {
+                        transform.Translate(step);
+                        transform.GetLocalMatrix();
+                    });
+            });
+        Report("transform update (ForEach)", entityCount, serialTime);
+
+        for (uint32_t threads : { 1u, 2u, 4u, 8u, 16u })
+        {
+            JobSystem jobs(threads - 1);
+            std::string suffix = " (" + std::to_string(threads) + " threads)";
+
+            double transformTime = Measure(5, []() {},
+                [&]()
+                {
+                    registry.View<Transform>().ParallelForEach(jobs, [&](Entity, Transform& transform)
+                        {
+                            transform.Translate(step);
+                            transform.GetLocalMatrix();
+                        });
+                });
+            Report("transform update" + suffix, entityCount, transformTime);
+
+            // Culling-style read-only pass over a two-component view
+            std::atomic<uint32_t> visible{ 0 };
+            double cullTime = Measure(5, []() {},
+                [&]()
+                {
+                    registry.View<const Transform, const MeshRenderer>().ParallelForEach(jobs,
+                        [&](Entity, const Transform& transform, const MeshRenderer& mesh)
+                        {
+                            if (mesh.visible && transform.position.x * transform.position.x < 1.0e10f)
+                                visible.fetch_add(1, std::memory_order_relaxed);
+                        });
+                });
+            Report("cull Transform+Mesh" + suffix, entityCount / 2, cullTime);
+
+            DoNotOptimize(visible.load());
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#include "Benchmark.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/RegistryHistory.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include <memory>
+
+namespace Nexus::Benchmark
+{
+    // Trivially copyable per-entity simulation state, the bulk of a rollback frame
+    struct RollbackBody
+    {
+        float position[3] = {};
+        float velocity[3] = {};
+    };
+
+    void RunRollbackBenchmarks()
+    {
+        NEXUS_INFO("--- Rollback: clone and rewind ---");
+
+        const size_t count = 100000;
+        const size_t frameCount = 60;
+        const size_t movedPerFrame = count / 10;
+
+        std::unique_ptr<Registry> registry;
+        std::unique_ptr<RegistryHistory> history;
+        std::vector<Entity> entities(count);
+
+        // 100k entities, frameCount recorded frames that each move 10% of them
+        auto simulate = [&]()
+        {
+            history.reset();
+            registry = std::make_unique<Registry>();
+            registry->CreateEntities(count, entities);
+            registry->AddComponents<Transform>(entities, Transform(Vector3(1.0f, 2.0f, 3.0f)));
+            registry->AddComponents<MeshRenderer>(entities, MeshRenderer(1, 2));
+            registry->AddComponents<RollbackBody>(entities, RollbackBody());
+
+            history = std::make_unique<RegistryHistory>(*registry, frameCount);
+            for (size_t frame = 0; frame < frameCount; frame++)
+            {
+                for (size_t i = 0; i < movedPerFrame; i++)
+                {
+                    Entity entity = entities[(frame * movedPerFrame + i * 7) % count];
+                    registry->GetComponent<RollbackBody>(entity).position[0] += 1.0f;
+                }
+                history->Record();
+            }
+        };
+
+        simulate();
+        std::unique_ptr<Registry> clone;
+        double cloneTime = Measure(5, [&]() { clone.reset(); }, [&]() { clone = registry->Clone(); });
+        Report("clone", count, cloneTime);
+
+        double recordTime = Measure(5, []() {},
+            [&]()
+            {
+                for (size_t i = 0; i < movedPerFrame; i++)
+                {
+                    registry->GetComponent<RollbackBody>(entities[i * 3]).position[1] += 1.0f;
+                }
+                history->Record();
+            });
+        Report("record frame (10% changed, ring full)", count, recordTime);
+
+        double oldestTime = Measure(3, simulate, [&]() { history->Rewind(frameCount); });
+        Report("rewind 60 frames", count, oldestTime);
+
+        double newestTime = Measure(3, simulate, [&]() { history->Rewind(1); });
+        Report("rewind 1 frame (replays 59)", count, newestTime);
+
+        char line[128];
+        std::snprintf(line, sizeof(line), "history memory: %.2f MiB for %zu frames",
+            history->GetMemoryBytes() / (1024.0 * 1024.0), history->GetFrameCount());
+        NEXUS_INFO(line);
+    }
+}
@@ -0,0 +1,88 @@
+#include "Benchmark.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Snapshot.h"
+#include "Scene/ECS/MappedScene.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include <filesystem>
+#include <memory>
+
+namespace Nexus::Benchmark
+{
+    // Trivially copyable gameplay data, written as one block
+    struct SnapshotHealth
+    {
+        float current = 100.0f;
+        float maximum = 100.0f;
+        uint32_t team = 0;
+    };
+
+    void RunSnapshotBenchmarks()
+    {
+        NEXUS_INFO("--- Registry snapshots: save and load ---");
+
+        RegistrySnapshot snapshot;
+        snapshot.RegisterComponent<SnapshotHealth>("SnapshotHealth");
+
+        for (size_t count : { size_t(100000), size_t(500000) })
+        {
+            Registry source;
+            std::vector<Entity> entities(count);
+            source.CreateEntities(count, entities);
+            source.AddComponents<Transform>(entities, Transform(Vector3(1.0f, 2.0f, 3.0f)));
+            source.AddComponents<MeshRenderer>(entities, MeshRenderer("props/crate.obj", "props/crate.mat"));
+            source.AddComponents<SnapshotHealth>(entities, SnapshotHealth());
+
+            std::vector<uint8_t> buffer;
+            snapshot.Save(source, buffer);
+
+            double saveTime = Measure(5, []() {}, [&]() { snapshot.Save(source, buffer); });
+            Report("save (reused buffer)", count, saveTime);
+
+            std::unique_ptr<Registry> target;
+            double loadTime = Measure(5, [&]() { target = std::make_unique<Registry>(); },
+                [&]() { snapshot.Load(*target, buffer); });
+            Report("load", count, loadTime);
+
+            NEXUS_INFO("snapshot size: " + std::to_string(buffer.size() / 1024) + " KiB");
+
+            // File-backed: copy everything into a registry vs. map the file and read the static
+            // props' Transform and MeshRenderer columns in place. The snapshot numbers its strings
+            // on its own, so in the saving process the MeshRenderer column is remapped once
+            // through a copy-on-write mapping (a process that maps the scene at startup reads
+            // it as is).
+            std::string path = (std::filesystem::temp_directory_path() / "NexusSnapshotBenchmark.bin").string();
+            snapshot.SaveToFile(source, path);
+
+            double fileTime = Measure(3, [&]() { target = std::make_unique<Registry>(); },
+                [&]() { snapshot.LoadFromFile(*target, path); });
+            Report("load from file", count, fileTime);
+
+            double mapTime = Measure(3, []() {},
+                [&]()
+                {
+                    MappedScene scene(path, MappedFile::Access::CopyOnWrite);
+                    float total = 0.0f;
+                    for (const Transform& transform : scene.GetComponents<Transform>("Transform"))
+                        total += transform.position.x;
+                    for (const MeshRenderer& meshRenderer : scene.GetMutableComponents<MeshRenderer>("MeshRenderer"))
+                        total += static_cast<float>(meshRenderer.meshPath.GetIndex());
+                    DoNotOptimize(total);
+                });
+            Report("map file + read Transform/MeshRenderer columns", count, mapTime);
+
+            // Static props: Transform and MeshRenderer stay in the mapping, the rest is loaded
+            const std::string mappedColumns[] = { "Transform", "MeshRenderer" };
+            double mapLoadTime = Measure(3, [&]() { target = std::make_unique<Registry>(); },
+                [&]()
+                {
+                    MappedScene scene(path);
+                    scene.Load(snapshot, *target, mappedColumns);
+                    DoNotOptimize(scene.GetComponents<Transform>("Transform").size());
+                });
+            Report("map file + load other components", count, mapLoadTime);
+
+            std::filesystem::remove(path);
+        }
+    }
+}
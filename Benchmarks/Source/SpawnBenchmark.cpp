@@ -0,0 +1,162 @@
+#include "Benchmark.h"
+#include "Core/JobSystem.h"
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/EntityCommandBuffer.h"
+#include "Scene/ECS/Prefab.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include "Scene/ECS/Components/Light.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+namespace Nexus::Benchmark
+{
+    // Trivially copyable particle payload, the typical burst-spawn case
+    struct Particle
+    {
+        float position[3] = {};
+        float velocity[3] = {};
+        float lifetime = 1.0f;
+        uint32_t color = 0xFFFFFFFF;
+    };
+
+    void RunSpawnBenchmarks()
+    {
+        NEXUS_INFO("--- Spawning: per-entity vs batch ---");
+
+        for (size_t count : { size_t(10000), size_t(100000) })
+        {
+            std::unique_ptr<Registry> registry;
+            std::vector<Entity> entities(count);
+            std::vector<Particle> particles(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                particles[i].position[0] = float(i);
+            }
+
+            double singleTime = Measure(5, [&]() { registry = std::make_unique<Registry>(); },
+                [&]()
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        Entity entity = registry->CreateEntity();
+                        registry->AddComponent<Particle>(entity, particles[i]);
+                        registry->AddComponent<MeshRenderer>(entity, uint32_t(1), uint32_t(2));
+                        entities[i] = entity;
+                    }
+                });
+            Report("spawn per-entity", count, singleTime);
+
+            double batchTime = Measure(5, [&]() { registry = std::make_unique<Registry>(); },
+                [&]()
+                {
+                    registry->CreateEntities(count, entities);
+                    registry->AddComponents<Particle>(entities, particles);
+                    registry->AddComponents<MeshRenderer>(entities, MeshRenderer(1, 2));
+                });
+            Report("spawn batch", count, batchTime);
+
+            double destroySingleTime = Measure(5,
+                [&]()
+                {
+                    registry = std::make_unique<Registry>();
+                    registry->CreateEntities(count, entities);
+                    registry->AddComponents<Particle>(entities, particles);
+                },
+                [&]()
+                {
+                    for (Entity entity : entities)
+                        registry->DestroyEntity(entity);
+                });
+            Report("destroy per-entity", count, destroySingleTime);
+
+            double destroyBatchTime = Measure(5,
+                [&]()
+                {
+                    registry = std::make_unique<Registry>();
+                    registry->CreateEntities(count, entities);
+                    registry->AddComponents<Particle>(entities, particles);
+                },
+                [&]() { registry->DestroyEntities(entities); });
+            Report("destroy batch", count, destroyBatchTime);
+        }
+
+        NEXUS_INFO("--- Spawning from jobs: reserved IDs + per-thread command buffers ---");
+
+        const size_t jobCount = 100000;
+        const size_t blockSize = 4096;
+        std::vector<Particle> jobParticles(jobCount);
+        for (uint32_t threads : { 1u, 4u, 8u })
+        {
+            JobSystem jobs(threads - 1);
+            std::vector<std::unique_ptr<EntityCommandBuffer>> buffers(jobs.GetThreadCount());
+            std::vector<EntityCommandBuffer*> bufferPointers;
+            for (std::unique_ptr<EntityCommandBuffer>& buffer : buffers)
+            {
+                buffer = std::make_unique<EntityCommandBuffer>();
+                bufferPointers.push_back(buffer.get());
+            }
+
+            std::unique_ptr<Registry> registry;
+            double spawnTime = std::numeric_limits<double>::max();
+            double mergeTime = Measure(5, [&]()
+                {
+                    registry = std::make_unique<Registry>();
+
+                    // Each job reserves its block of IDs with one atomic operation
+                    Timer timer;
+                    jobs.ParallelFor(jobCount, blockSize, [&](size_t begin, size_t end)
+                        {
+                            std::vector<Entity> block(end - begin);
+                            registry->ReserveEntities(block.size(), block);
+
+                            EntityCommandBuffer& buffer = *buffers[jobs.GetCurrentThreadIndex()];
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                buffer.AddComponent<Particle>(block[i - begin], jobParticles[i]);
+                            }
+                        });
+                    spawnTime = std::min(spawnTime, timer.ElapsedMilliseconds());
+                },
+                [&]() { EntityCommandBuffer::Playback(*registry, bufferPointers); });
+
+            std::string suffix = " (" + std::to_string(threads) + " threads)";
+            Report("reserve + record in jobs" + suffix, jobCount, spawnTime);
+            Report("merge (flush + playback)" + suffix, jobCount, mergeTime);
+        }
+
+        NEXUS_INFO("--- Spawning enemies: AddComponent sequence vs prefab ---");
+
+        Prefab enemy;
+        enemy.Add<Transform>(Vector3(0.0f, 1.0f, 0.0f))
+            .Add<MeshRenderer>("Assets/Meshes/enemy_grunt.obj", "Assets/Materials/enemy_grunt.mat")
+            .AddShared<Light>(Light::CreatePoint(4.0f, Vector3(1.0f, 0.2f, 0.2f)));
+
+        const size_t enemyCount = 10000;
+        std::unique_ptr<Registry> registry;
+        std::vector<Entity> enemies(enemyCount);
+
+        double sequenceTime = Measure(5, [&]() { registry = std::make_unique<Registry>(); },
+            [&]()
+            {
+                for (size_t i = 0; i < enemyCount; i++)
+                {
+                    Entity entity = registry->CreateEntity();
+                    registry->AddComponent<Transform>(entity, Vector3(0.0f, 1.0f, 0.0f));
+                    registry->AddComponent<MeshRenderer>(entity, "Assets/Meshes/enemy_grunt.obj", "Assets/Materials/enemy_grunt.mat");
+                    registry->AddComponent<Light>(entity, Light::CreatePoint(4.0f, Vector3(1.0f, 0.2f, 0.2f)));
+                }
+            });
+        Report("AddComponent sequence", enemyCount, sequenceTime);
+
+        double prefabTime = Measure(5, [&]() { registry = std::make_unique<Registry>(); },
+            [&]() { enemy.Instantiate(*registry, enemyCount, enemies); });
+        Report("prefab instantiate", enemyCount, prefabTime);
+
+        char line[128];
+        std::snprintf(line, sizeof(line), "per-instance light data: %zu bytes owned vs %zu bytes shared",
+            sizeof(Light), sizeof(Shared<Light>));
+        NEXUS_INFO(line);
+    }
+}
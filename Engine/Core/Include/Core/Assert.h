@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Core/Logger.h"
+#include <cstdlib>
+#include <string>
+
+// Debug-only assertion: logs the failed condition with its location and aborts.
+// Compiles to nothing outside NEXUS_DEBUG builds, so the condition must have no side effects.
+#ifdef NEXUS_DEBUG
+    #define NEXUS_ASSERT(condition, msg) \
+        do \
+        { \
+            if (!(condition)) \
+            { \
+                NEXUS_CORE_ERROR(std::string("Assertion failed: ") + (msg) + " (" #condition ") at " + \
+                    __FILE__ + ":" + std::to_string(__LINE__)); \
+                std::abort(); \
+            } \
+        } while (false)
+#else
+    #define NEXUS_ASSERT(condition, msg) do { } while (false)
+#endif
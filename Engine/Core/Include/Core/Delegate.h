@@ -0,0 +1,104 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nexus
+{
+    template<typename Signature>
+    class Delegate;
+
+    // Non-owning callable: a function pointer plus an optional instance pointer.
+    // Binding never allocates and calling is one indirect call, unlike std::function.
+    //   Delegate<void(int)>::Create<&FreeFunction>()
+    //   Delegate<void(int)>::Create<&Listener::OnEvent>(&listener)
+    template<typename R, typename... Args>
+    class Delegate<R(Args...)>
+    {
+    public:
+        Delegate() = default;
+
+        template<auto Function>
+        static Delegate Create()
+        {
+            Delegate delegate;
+            delegate.m_Stub = [](void*, Args... args) -> R { return Function(std::forward<Args>(args)...); };
+            return delegate;
+        }
+
+        template<auto Method, typename T>
+        static Delegate Create(T* instance)
+        {
+            static_assert(std::is_member_function_pointer_v<decltype(Method)>, "Create(instance) takes a member function");
+
+            Delegate delegate;
+            delegate.m_Instance = const_cast<void*>(static_cast<const void*>(instance));
+            delegate.m_Stub = [](void* object, Args... args) -> R { return (static_cast<T*>(object)->*Method)(std::forward<Args>(args)...); };
+            return delegate;
+        }
+
+        R operator()(Args... args) const { return m_Stub(m_Instance, std::forward<Args>(args)...); }
+
+        bool IsValid() const { return m_Stub != nullptr; }
+
+        bool operator==(const Delegate& other) const { return m_Stub == other.m_Stub && m_Instance == other.m_Instance; }
+        bool operator!=(const Delegate& other) const { return !(*this == other); }
+
+    private:
+        void* m_Instance = nullptr;
+        R (*m_Stub)(void*, Args...) = nullptr;
+    };
+
+    // List of delegates called in connection order. Publishing with no listeners is a single
+    // empty check. Listeners must not connect or disconnect while the signal is publishing.
+    template<typename Signature>
+    class Signal;
+
+    template<typename... Args>
+    class Signal<void(Args...)>
+    {
+    public:
+        using DelegateType = Delegate<void(Args...)>;
+
+        template<auto Function>
+        void Connect() { m_Listeners.push_back(DelegateType::template Create<Function>()); }
+
+        template<auto Method, typename T>
+        void Connect(T* instance) { m_Listeners.push_back(DelegateType::template Create<Method>(instance)); }
+
+        template<auto Function>
+        void Disconnect() { Remove(DelegateType::template Create<Function>()); }
+
+        template<auto Method, typename T>
+        void Disconnect(T* instance) { Remove(DelegateType::template Create<Method>(instance)); }
+
+        void Clear() { m_Listeners.clear(); }
+
+        bool IsEmpty() const { return m_Listeners.empty(); }
+        size_t GetListenerCount() const { return m_Listeners.size(); }
+
+        void Publish(Args... args) const
+        {
+            for (const DelegateType& listener : m_Listeners)
+            {
+                listener(args...);
+            }
+        }
+
+    private:
+        void Remove(const DelegateType& delegate)
+        {
+            for (size_t i = 0; i < m_Listeners.size(); i++)
+            {
+                if (m_Listeners[i] == delegate)
+                {
+                    m_Listeners.erase(m_Listeners.begin() + i);
+                    return;
+                }
+            }
+        }
+
+        std::vector<DelegateType> m_Listeners;
+    };
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Nexus
+{
+    // Minimal spin lock for very short critical sections
+    class SpinLock
+    {
+    public:
+        void Lock()
+        {
+            while (m_Flag.test_and_set(std::memory_order_acquire))
+            {
+                while (m_Flag.test(std::memory_order_relaxed))
+                    std::this_thread::yield();
+            }
+        }
+
+        void Unlock() { m_Flag.clear(std::memory_order_release); }
+
+    private:
+        std::atomic_flag m_Flag = ATOMIC_FLAG_INIT;
+    };
+
+    class JobCounter;
+
+    // A unit of work: a function pointer plus a small inline copy of the callable.
+    // Jobs never allocate; callables must be trivially copyable and fit in INLINE_SIZE bytes,
+    // so capture large state by reference or pointer.
+    class Job
+    {
+    public:
+        static constexpr size_t INLINE_SIZE = 48;
+
+        Job() = default;
+
+        template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, Job>>>
+        Job(Func&& func)
+        {
+            using Callable = std::decay_t<Func>;
+            static_assert(sizeof(Callable) <= INLINE_SIZE, "Job callable too large, capture by reference");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Job callable over-aligned");
+            static_assert(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>,
+                "Job callables must be trivially copyable");
+
+            new (m_Storage) Callable(std::forward<Func>(func));
+            m_Function = [](void* storage) { (*static_cast<Callable*>(storage))(); };
+        }
+
+        void Execute() { m_Function(m_Storage); }
+        bool IsValid() const { return m_Function != nullptr; }
+
+    private:
+        void (*m_Function)(void*) = nullptr;
+        JobCounter* m_Counter = nullptr;            // Signalled when the job has finished
+        alignas(std::max_align_t) unsigned char m_Storage[INLINE_SIZE];
+
+        friend class JobSystem;
+    };
+
+    // Counts outstanding jobs. Jobs scheduled with a counter increment it and decrement it
+    // when they finish; jobs scheduled with RunAfter start once it reaches zero.
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+
+    private:
+        std::atomic<uint32_t> m_Count{ 0 };
+        SpinLock m_Lock;                            // Guards m_Continuations
+        std::vector<Job> m_Continuations;           // Jobs waiting for this counter to reach zero
+
+        friend class JobSystem;
+    };
+
+    // Work-stealing job system.
+    // Every thread (workers plus the thread that created the system) owns a deque; a thread
+    // pushes and pops its own jobs LIFO and steals FIFO from the others when it runs dry.
+    // Waiting on a counter executes pending jobs instead of blocking.
+    class JobSystem
+    {
+    public:
+        // workerCount == 0 uses one worker per hardware thread, minus the calling thread
+        explicit JobSystem(uint32_t workerCount = 0);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // Schedule a job; counter (optional) is incremented now and decremented when it finishes
+        void Run(Job job, JobCounter* counter = nullptr);
+
+        // Schedule a job to start once dependency reaches zero
+        void RunAfter(JobCounter& dependency, Job job, JobCounter* counter = nullptr);
+
+        // Execute jobs until counter reaches zero; a counter must not be destroyed before Wait returns
+        void Wait(JobCounter& counter);
+
+        // Split [0, count) into batches of batchSize and call func(begin, end) for each in parallel.
+        // Returns when all batches have finished; the calling thread helps.
+        template<typename Func>
+        void ParallelFor(size_t count, size_t batchSize, const Func& func)
+        {
+            if (count == 0)
+                return;
+
+            batchSize = batchSize ? batchSize : 1;
+            if (count <= batchSize || GetThreadCount() == 1)
+            {
+                func(size_t(0), count);
+                return;
+            }
+
+            JobCounter counter;
+            const Func* function = &func;
+            for (size_t begin = 0; begin < count; begin += batchSize)
+            {
+                size_t end = begin + batchSize < count ? begin + batchSize : count;
+                Run([function, begin, end]() { (*function)(begin, end); }, &counter);
+            }
+            Wait(counter);
+        }
+
+        // Worker threads plus the owning thread
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_Queues.size()); }
+
+        // Index of the calling thread in [0, GetThreadCount()); 0 for the owning thread and
+        // for threads that do not belong to this system
+        uint32_t GetCurrentThreadIndex() const;
+
+    private:
+        // Deque owned by one thread, guarded by a spin lock
+        class WorkQueue
+        {
+        public:
+            void Push(const Job& job);
+            bool Pop(Job& job);     // Owner end (LIFO)
+            bool Steal(Job& job);   // Opposite end (FIFO)
+
+        private:
+            SpinLock m_Lock;
+            std::vector<Job> m_Jobs;
+            size_t m_Head = 0;      // Index of the oldest job
+        };
+
+        void WorkerLoop(uint32_t threadIndex);
+        bool TryRunOne(uint32_t threadIndex);
+        void Execute(Job& job);
+        void Finish(JobCounter* counter);
+        void Submit(const Job& job);
+
+        std::vector<std::unique_ptr<WorkQueue>> m_Queues;   // One per thread, index 0 is the owner
+        std::vector<std::thread> m_Workers;
+
+        std::atomic<bool> m_Running{ true };
+        std::atomic<uint32_t> m_PendingJobs{ 0 };
+        std::atomic<uint32_t> m_SleepingWorkers{ 0 };
+        std::mutex m_SleepMutex;
+        std::condition_variable m_WakeCondition;
+    };
+}
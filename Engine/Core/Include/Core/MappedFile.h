@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Nexus
+{
+    // Read-only or copy-on-write memory mapping of a whole file.
+    // Pages are loaded on first touch, and read-only mappings of the same file share physical
+    // pages between processes. Writes to a copy-on-write mapping stay private to this process
+    // and never reach the file.
+    class MappedFile
+    {
+    public:
+        enum class Access
+        {
+            ReadOnly,
+            CopyOnWrite
+        };
+
+        MappedFile() = default;
+        explicit MappedFile(const std::string& path, Access access = Access::ReadOnly);
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        Access GetAccess() const { return m_Access; }
+        size_t GetSize() const { return m_Size; }
+
+        std::span<const uint8_t> GetData() const { return std::span<const uint8_t>(m_Data, m_Size); }
+
+        // Writable view, copy-on-write mappings only
+        std::span<uint8_t> GetMutableData();
+
+    private:
+        void MoveFrom(MappedFile& other);
+
+        uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        Access m_Access = Access::ReadOnly;
+
+#ifdef NEXUS_PLATFORM_WINDOWS
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace Nexus
+{
+    // Bump allocator over one contiguous region, usable wherever a std::pmr::memory_resource is.
+    // Allocation is an aligned pointer bump; deallocation is free (only the most recent
+    // allocation is actually returned). Reset releases everything at once, e.g. when a level
+    // that was loaded into an arena-backed Registry is torn down.
+    //
+    // Growing containers leave their old buffers behind, so reserve up front or size the arena
+    // with headroom. Allocating past the capacity throws std::bad_alloc. Not thread safe.
+    class MemoryArena final : public std::pmr::memory_resource
+    {
+    public:
+        // Arena that owns a region of capacity bytes
+        explicit MemoryArena(size_t capacity);
+
+        // Arena over memory provided by the caller (e.g. huge pages or NUMA-local memory),
+        // which must outlive the arena
+        MemoryArena(void* buffer, size_t capacity);
+
+        ~MemoryArena() override;
+
+        MemoryArena(const MemoryArena&) = delete;
+        MemoryArena& operator=(const MemoryArena&) = delete;
+
+        // Release every allocation. Objects still using arena memory must be gone by now.
+        void Reset() { m_Offset = 0; }
+
+        size_t GetCapacity() const { return m_Capacity; }
+        size_t GetUsed() const { return m_Offset; }
+        size_t GetPeak() const { return m_Peak; }
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::byte* m_Buffer;
+        size_t m_Capacity;
+        size_t m_Offset = 0;
+        size_t m_Peak = 0;
+        bool m_OwnsBuffer;
+    };
+}
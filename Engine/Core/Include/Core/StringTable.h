@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Nexus
+{
+    // Handle to a string interned in the StringTable: 4 bytes, compared as an integer.
+    // Handles stay valid for the lifetime of the process but differ between runs, so persist
+    // the string (GetString), never the handle. The default handle is the empty string.
+    class StringID
+    {
+    public:
+        StringID() = default;
+
+        // Interns text (one hash lookup; take the handle once and keep it in hot code)
+        explicit StringID(std::string_view text);
+
+        uint32_t GetIndex() const { return m_Index; }
+        const std::string& GetString() const;
+        uint32_t GetHash() const;
+        bool IsEmpty() const { return m_Index == 0; }
+
+        bool operator==(const StringID& other) const { return m_Index == other.m_Index; }
+        bool operator!=(const StringID& other) const { return m_Index != other.m_Index; }
+
+    private:
+        friend class StringTable;
+        explicit StringID(uint32_t index) : m_Index(index) {}
+
+        uint32_t m_Index = 0;
+    };
+
+    // Process-wide table of interned strings. Each distinct string is stored once, with its
+    // hash computed at interning time. Entries never move or go away, so GetString is a plain
+    // array access without locking. Interning and Find are thread safe.
+    class StringTable
+    {
+    public:
+        static StringTable& Get();
+
+        // Handle of text, adding it to the table on first use
+        StringID Intern(std::string_view text);
+
+        // Handle of text if it was interned before; never adds to the table
+        std::optional<StringID> Find(std::string_view text) const;
+
+        const std::string& GetString(StringID id) const { return GetEntry(id.GetIndex()).text; }
+        uint32_t GetHash(StringID id) const { return GetEntry(id.GetIndex()).hash; }
+
+        size_t GetCount() const { return m_Count.load(std::memory_order_acquire); }
+
+        // Handle of the entry at index (below GetCount()), to walk the whole table
+        StringID GetID(uint32_t index) const { return StringID(index); }
+
+        // 32-bit FNV-1a, the hash stored with every entry
+        static uint32_t Hash(std::string_view text);
+
+        StringTable(const StringTable&) = delete;
+        StringTable& operator=(const StringTable&) = delete;
+
+    private:
+        StringTable();
+        ~StringTable();
+
+        struct Entry
+        {
+            std::string text;
+            uint32_t hash = 0;
+        };
+
+        struct ViewHash
+        {
+            size_t operator()(std::string_view text) const { return Hash(text); }
+        };
+
+        static constexpr uint32_t PAGE_SIZE = 1024;
+        static constexpr uint32_t MAX_PAGES = 4096;    // Up to 4M distinct strings
+
+        const Entry& GetEntry(uint32_t index) const
+        {
+            return m_Pages[index / PAGE_SIZE].load(std::memory_order_acquire)[index % PAGE_SIZE];
+        }
+
+        std::array<std::atomic<Entry*>, MAX_PAGES> m_Pages{};      // Fixed-size pages, allocated on demand
+        std::unordered_map<std::string_view, uint32_t, ViewHash> m_Lookup;   // Views into the entries
+        std::atomic<uint32_t> m_Count = 0;
+        mutable std::shared_mutex m_Mutex;                          // Guards m_Lookup and adding entries
+    };
+
+    inline StringID::StringID(std::string_view text) : m_Index(StringTable::Get().Intern(text).m_Index) {}
+    inline const std::string& StringID::GetString() const { return StringTable::Get().GetString(*this); }
+    inline uint32_t StringID::GetHash() const { return StringTable::Get().GetHash(*this); }
+}
+
+template<>
+struct std::hash<Nexus::StringID>
+{
+    size_t operator()(Nexus::StringID id) const { return id.GetIndex(); }
+};
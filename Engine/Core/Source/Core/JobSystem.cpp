@@ -0,0 +1,238 @@
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+
+namespace Nexus
+{
+    static thread_local const JobSystem* t_JobSystem = nullptr;
+    static thread_local uint32_t t_ThreadIndex = 0;
+
+    // Spin this many times looking for work before a worker goes to sleep
+    static constexpr int IDLE_SPIN_COUNT = 64;
+
+    void JobSystem::WorkQueue::Push(const Job& job)
+    {
+        m_Lock.Lock();
+        m_Jobs.push_back(job);
+        m_Lock.Unlock();
+    }
+
+    bool JobSystem::WorkQueue::Pop(Job& job)
+    {
+        m_Lock.Lock();
+        bool found = m_Jobs.size() > m_Head;
+        if (found)
+        {
+            job = m_Jobs.back();
+            m_Jobs.pop_back();
+            if (m_Jobs.size() == m_Head)
+            {
+                m_Jobs.clear();
+                m_Head = 0;
+            }
+        }
+        m_Lock.Unlock();
+        return found;
+    }
+
+    bool JobSystem::WorkQueue::Steal(Job& job)
+    {
+        m_Lock.Lock();
+        bool found = m_Jobs.size() > m_Head;
+        if (found)
+        {
+            job = m_Jobs[m_Head++];
+            if (m_Jobs.size() == m_Head)
+            {
+                m_Jobs.clear();
+                m_Head = 0;
+            }
+        }
+        m_Lock.Unlock();
+        return found;
+    }
+
+    JobSystem::JobSystem(uint32_t workerCount)
+    {
+        if (workerCount == 0)
+        {
+            uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        // Queue 0 belongs to the thread that owns the system
+        for (uint32_t i = 0; i <= workerCount; i++)
+        {
+            m_Queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        t_JobSystem = this;
+        t_ThreadIndex = 0;
+
+        for (uint32_t i = 1; i <= workerCount; i++)
+        {
+            m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+
+        NEXUS_CORE_INFO("JobSystem started with " + std::to_string(workerCount) + " worker threads");
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_Running.store(false);
+        }
+        m_WakeCondition.notify_all();
+
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+
+        if (t_JobSystem == this)
+            t_JobSystem = nullptr;
+    }
+
+    void JobSystem::Run(Job job, JobCounter* counter)
+    {
+        if (counter)
+            counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+        job.m_Counter = counter;
+        Submit(job);
+    }
+
+    void JobSystem::RunAfter(JobCounter& dependency, Job job, JobCounter* counter)
+    {
+        if (counter)
+            counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+        job.m_Counter = counter;
+
+        dependency.m_Lock.Lock();
+        if (dependency.IsDone())
+        {
+            dependency.m_Lock.Unlock();
+            Submit(job);
+            return;
+        }
+
+        dependency.m_Continuations.push_back(job);
+        dependency.m_Lock.Unlock();
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        uint32_t threadIndex = GetCurrentThreadIndex();
+
+        while (!counter.IsDone())
+        {
+            if (!TryRunOne(threadIndex))
+                std::this_thread::yield();
+        }
+
+        // The last job may still hold the counter's lock; wait for it so the caller can
+        // safely destroy the counter
+        counter.m_Lock.Lock();
+        counter.m_Lock.Unlock();
+    }
+
+    uint32_t JobSystem::GetCurrentThreadIndex() const
+    {
+        return t_JobSystem == this ? t_ThreadIndex : 0;
+    }
+
+    void JobSystem::WorkerLoop(uint32_t threadIndex)
+    {
+        t_JobSystem = this;
+        t_ThreadIndex = threadIndex;
+
+        int idleSpins = 0;
+        while (m_Running.load(std::memory_order_relaxed))
+        {
+            if (TryRunOne(threadIndex))
+            {
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < IDLE_SPIN_COUNT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Nothing to do: sleep until new work is submitted
+            std::unique_lock<std::mutex> lock(m_SleepMutex);
+            m_SleepingWorkers.fetch_add(1);
+            m_WakeCondition.wait(lock, [this]() { return m_PendingJobs.load() > 0 || !m_Running.load(); });
+            m_SleepingWorkers.fetch_sub(1);
+            idleSpins = 0;
+        }
+    }
+
+    bool JobSystem::TryRunOne(uint32_t threadIndex)
+    {
+        Job job;
+        bool found = m_Queues[threadIndex]->Pop(job);
+
+        // Steal from the other queues, starting with the next one
+        uint32_t queueCount = GetThreadCount();
+        for (uint32_t i = 1; !found && i < queueCount; i++)
+        {
+            found = m_Queues[(threadIndex + i) % queueCount]->Steal(job);
+        }
+
+        if (!found)
+            return false;
+
+        m_PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::Execute(Job& job)
+    {
+        job.Execute();
+        Finish(job.m_Counter);
+    }
+
+    void JobSystem::Finish(JobCounter* counter)
+    {
+        if (!counter)
+            return;
+
+        // Fast path: not the last job on this counter
+        uint32_t count = counter->m_Count.load(std::memory_order_relaxed);
+        while (count > 1)
+        {
+            if (counter->m_Count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel))
+                return;
+        }
+
+        // Possibly the last job: decrement under the lock so a waiter cannot destroy the
+        // counter while its continuations are being taken
+        std::vector<Job> continuations;
+        counter->m_Lock.Lock();
+        if (counter->m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            continuations.swap(counter->m_Continuations);
+        counter->m_Lock.Unlock();
+
+        for (const Job& job : continuations)
+        {
+            Submit(job);
+        }
+    }
+
+    void JobSystem::Submit(const Job& job)
+    {
+        m_Queues[GetCurrentThreadIndex()]->Push(job);
+        m_PendingJobs.fetch_add(1);
+
+        if (m_SleepingWorkers.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_SleepMutex);
+            m_WakeCondition.notify_one();
+        }
+    }
+}
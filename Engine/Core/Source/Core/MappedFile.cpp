@@ -0,0 +1,144 @@
+#include "Core/MappedFile.h"
+#include <stdexcept>
+#include <utility>
+
+#ifdef NEXUS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Nexus
+{
+#ifdef NEXUS_PLATFORM_WINDOWS
+    MappedFile::MappedFile(const std::string& path, Access access)
+        : m_Access(access)
+    {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Failed to open file for mapping: " + path);
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            throw std::runtime_error("Cannot map an empty file: " + path);
+        }
+
+        DWORD protection = access == Access::ReadOnly ? PAGE_READONLY : PAGE_WRITECOPY;
+        HANDLE mapping = CreateFileMappingA(file, nullptr, protection, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            throw std::runtime_error("Failed to create file mapping: " + path);
+        }
+
+        DWORD viewAccess = access == Access::ReadOnly ? FILE_MAP_READ : FILE_MAP_COPY;
+        void* view = MapViewOfFile(mapping, viewAccess, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("Failed to map file: " + path);
+        }
+
+        m_Data = static_cast<uint8_t*>(view);
+        m_Size = static_cast<size_t>(size.QuadPart);
+        m_FileHandle = file;
+        m_MappingHandle = mapping;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+            UnmapViewOfFile(m_Data);
+        if (m_MappingHandle)
+            CloseHandle(m_MappingHandle);
+        if (m_FileHandle)
+            CloseHandle(m_FileHandle);
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_FileHandle = nullptr;
+        m_MappingHandle = nullptr;
+    }
+#else
+    MappedFile::MappedFile(const std::string& path, Access access)
+        : m_Access(access)
+    {
+        int file = open(path.c_str(), O_RDONLY);
+        if (file < 0)
+            throw std::runtime_error("Failed to open file for mapping: " + path);
+
+        struct stat status;
+        if (fstat(file, &status) != 0 || status.st_size == 0)
+        {
+            close(file);
+            throw std::runtime_error("Cannot map an empty file: " + path);
+        }
+
+        // MAP_PRIVATE gives copy-on-write; read-only private mappings still share the page cache
+        int protection = access == Access::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* view = mmap(nullptr, static_cast<size_t>(status.st_size), protection, MAP_PRIVATE, file, 0);
+        close(file);     // The mapping keeps its own reference to the file
+        if (view == MAP_FAILED)
+            throw std::runtime_error("Failed to map file: " + path);
+
+        m_Data = static_cast<uint8_t*>(view);
+        m_Size = static_cast<size_t>(status.st_size);
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+            munmap(m_Data, m_Size);
+
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    std::span<uint8_t> MappedFile::GetMutableData()
+    {
+        if (m_Access != Access::CopyOnWrite)
+            throw std::runtime_error("Mapping is read-only");
+        return std::span<uint8_t>(m_Data, m_Size);
+    }
+
+    void MappedFile::MoveFrom(MappedFile& other)
+    {
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+        m_Access = other.m_Access;
+#ifdef NEXUS_PLATFORM_WINDOWS
+        m_FileHandle = std::exchange(other.m_FileHandle, nullptr);
+        m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#endif
+    }
+}
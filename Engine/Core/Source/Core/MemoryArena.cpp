@@ -0,0 +1,47 @@
+#include "Core/MemoryArena.h"
+#include <cstdint>
+#include <new>
+
+namespace Nexus
+{
+    static constexpr size_t ARENA_ALIGNMENT = 64;
+
+    MemoryArena::MemoryArena(size_t capacity)
+        : m_Buffer(static_cast<std::byte*>(::operator new(capacity, std::align_val_t(ARENA_ALIGNMENT)))),
+          m_Capacity(capacity), m_OwnsBuffer(true)
+    {
+    }
+
+    MemoryArena::MemoryArena(void* buffer, size_t capacity)
+        : m_Buffer(static_cast<std::byte*>(buffer)), m_Capacity(capacity), m_OwnsBuffer(false)
+    {
+    }
+
+    MemoryArena::~MemoryArena()
+    {
+        if (m_OwnsBuffer)
+            ::operator delete(m_Buffer, std::align_val_t(ARENA_ALIGNMENT));
+    }
+
+    void* MemoryArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_Buffer);
+        std::uintptr_t aligned = (base + m_Offset + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        size_t offset = aligned - base;
+
+        if (offset > m_Capacity || bytes > m_Capacity - offset)
+            throw std::bad_alloc();
+
+        m_Offset = offset + bytes;
+        if (m_Offset > m_Peak)
+            m_Peak = m_Offset;
+        return m_Buffer + offset;
+    }
+
+    void MemoryArena::do_deallocate(void* pointer, size_t bytes, size_t)
+    {
+        // Hand the most recent allocation back; everything else waits for Reset
+        if (static_cast<std::byte*>(pointer) + bytes == m_Buffer + m_Offset)
+            m_Offset = static_cast<std::byte*>(pointer) - m_Buffer;
+    }
+}
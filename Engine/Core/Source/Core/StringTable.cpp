@@ -0,0 +1,77 @@
+#include "Core/StringTable.h"
+#include <mutex>
+#include <stdexcept>
+
+namespace Nexus
+{
+    StringTable& StringTable::Get()
+    {
+        static StringTable s_Instance;
+        return s_Instance;
+    }
+
+    StringTable::StringTable()
+    {
+        // Index 0 is the empty string, so default handles need no table access
+        Intern(std::string_view());
+    }
+
+    StringTable::~StringTable()
+    {
+        for (std::atomic<Entry*>& page : m_Pages)
+        {
+            delete[] page.load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t StringTable::Hash(std::string_view text)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : text)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    StringID StringTable::Intern(std::string_view text)
+    {
+        if (std::optional<StringID> existing = Find(text))
+            return *existing;
+
+        std::unique_lock lock(m_Mutex);
+
+        // Another thread may have added it between the two locks
+        auto it = m_Lookup.find(text);
+        if (it != m_Lookup.end())
+            return StringID(it->second);
+
+        uint32_t index = m_Count.load(std::memory_order_relaxed);
+        if (index == PAGE_SIZE * MAX_PAGES)
+            throw std::runtime_error("String table is full");
+
+        Entry* page = m_Pages[index / PAGE_SIZE].load(std::memory_order_relaxed);
+        if (!page)
+        {
+            page = new Entry[PAGE_SIZE];
+            m_Pages[index / PAGE_SIZE].store(page, std::memory_order_release);
+        }
+
+        Entry& entry = page[index % PAGE_SIZE];
+        entry.text = std::string(text);
+        entry.hash = Hash(text);
+        m_Lookup.emplace(std::string_view(entry.text), index);
+        m_Count.store(index + 1, std::memory_order_release);
+        return StringID(index);
+    }
+
+    std::optional<StringID> StringTable::Find(std::string_view text) const
+    {
+        std::shared_lock lock(m_Mutex);
+        auto it = m_Lookup.find(text);
+        if (it == m_Lookup.end())
+            return std::nullopt;
+        return StringID(it->second);
+    }
+}
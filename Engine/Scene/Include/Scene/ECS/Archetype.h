@@ -0,0 +1,136 @@
+#pragma once
+#include "Types.h"
+#include <array>
+#include <vector>
+#include <new>
+#include <utility>
+
+namespace Nexus
+{
+    // Size of one archetype chunk in bytes
+    constexpr size_t ARCHETYPE_CHUNK_SIZE = 16 * 1024;
+
+    // Type-erased description of a component type, used by archetype storage to move
+    // and destroy components it only knows as raw bytes
+    struct ComponentTypeInfo
+    {
+        ComponentTypeID id;
+        size_t size;
+        size_t alignment;
+        void (*moveConstruct)(void* destination, void* source);
+        void (*destroy)(void* component);
+    };
+
+    template<typename T>
+    const ComponentTypeInfo& GetComponentTypeInfo()
+    {
+        static_assert(alignof(T) <= 64, "Archetype chunks are 64-byte aligned");
+
+        static const ComponentTypeInfo s_Info{
+            GetComponentTypeID<T>(),
+            sizeof(T),
+            alignof(T),
+            [](void* destination, void* source) { new (destination) T(std::move(*static_cast<T*>(source))); },
+            [](void* component) { static_cast<T*>(component)->~T(); }
+        };
+        return s_Info;
+    }
+
+    // All entities with exactly the same set of component types.
+    // Entities are packed into fixed-size chunks; inside a chunk every component type is a
+    // contiguous column, preceded by a column of entity IDs. Rows are numbered globally, so
+    // row r lives in chunk r / capacity, and every chunk except the last one is full.
+    class Archetype
+    {
+    public:
+        static constexpr size_t INVALID_COLUMN = SIZE_MAX;
+
+        explicit Archetype(std::vector<const ComponentTypeInfo*> types);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        // Component layout
+        const std::vector<const ComponentTypeInfo*>& GetTypes() const { return m_Types; }
+        const ComponentSignature& GetSignature() const { return m_Signature; }
+        bool HasType(ComponentTypeID id) const { return m_Signature.test(id); }
+
+        size_t GetColumn(ComponentTypeID id) const
+        {
+            return m_Signature.test(id) ? m_ColumnLookup[id] : INVALID_COLUMN;
+        }
+
+        // Size queries
+        size_t GetEntityCount() const { return m_Count; }
+        size_t GetChunkCapacity() const { return m_ChunkCapacity; }
+        size_t GetChunkCount() const { return (m_Count + m_ChunkCapacity - 1) / m_ChunkCapacity; }
+        size_t GetChunkEntityCount(size_t chunk) const
+        {
+            size_t first = chunk * m_ChunkCapacity;
+            return m_Count - first < m_ChunkCapacity ? m_Count - first : m_ChunkCapacity;
+        }
+
+        // Chunk column access
+        EntityID* GetChunkEntities(size_t chunk) const
+        {
+            return reinterpret_cast<EntityID*>(m_Chunks[chunk]);
+        }
+
+        void* GetChunkColumn(size_t chunk, size_t column) const
+        {
+            return m_Chunks[chunk] + m_ColumnOffsets[column];
+        }
+
+        template<typename T>
+        T* GetChunkColumn(size_t chunk, size_t column) const
+        {
+            return static_cast<T*>(GetChunkColumn(chunk, column));
+        }
+
+        // Row access
+        EntityID GetEntity(size_t row) const
+        {
+            return GetChunkEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity];
+        }
+
+        void* GetComponent(size_t row, size_t column) const
+        {
+            return static_cast<std::byte*>(GetChunkColumn(row / m_ChunkCapacity, column)) +
+                (row % m_ChunkCapacity) * m_Types[column]->size;
+        }
+
+        // Append a row for an entity. Component memory is left uninitialized for the caller.
+        size_t AllocateRow(EntityID entity);
+
+        // Destroy the row's components and fill the hole with the last row.
+        // Returns the entity that moved into the row, or NULL_ENTITY if none did.
+        EntityID RemoveRow(size_t row);
+
+        // Move the row into another archetype: shared components are moved, the rest destroyed.
+        // Components only present in the destination are left uninitialized for the caller.
+        // Returns the row in the destination; movedEntity receives the entity that filled the hole.
+        size_t MoveRow(size_t row, Archetype& destination, EntityID& movedEntity);
+
+        // Cached transitions to the archetype with one component type added or removed
+        Archetype* GetAddEdge(ComponentTypeID id) const { return m_AddEdges[id]; }
+        Archetype* GetRemoveEdge(ComponentTypeID id) const { return m_RemoveEdges[id]; }
+        void SetAddEdge(ComponentTypeID id, Archetype* archetype) { m_AddEdges[id] = archetype; }
+        void SetRemoveEdge(ComponentTypeID id, Archetype* archetype) { m_RemoveEdges[id] = archetype; }
+
+    private:
+        EntityID FillHole(size_t row);
+
+        std::vector<const ComponentTypeInfo*> m_Types;  // Sorted by type ID
+        ComponentSignature m_Signature;
+        std::array<uint8_t, MAX_COMPONENTS> m_ColumnLookup = {}; // Column of each type in m_Signature
+        std::vector<size_t> m_ColumnOffsets;           // Byte offset of each column inside a chunk
+        std::vector<std::byte*> m_Chunks;              // Allocated chunks (may exceed the ones in use)
+        size_t m_ChunkBytes = ARCHETYPE_CHUNK_SIZE;
+        size_t m_ChunkCapacity = 0;
+        size_t m_Count = 0;
+
+        std::array<Archetype*, MAX_COMPONENTS> m_AddEdges = {};
+        std::array<Archetype*, MAX_COMPONENTS> m_RemoveEdges = {};
+    };
+}
@@ -0,0 +1,426 @@
+#pragma once
+#include "Types.h"
+#include "Archetype.h"
+#include "View.h"
+#include "EntityPool.h"
+#include <array>
+#include <unordered_map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nexus
+{
+    class ArchetypeRegistry; // Forward declaration
+
+    // Entity handle for ArchetypeRegistry, mirroring Entity so code written against
+    // one backend compiles against the other
+    class ArchetypeEntity
+    {
+    public:
+        ArchetypeEntity() : m_ID(NULL_ENTITY), m_Registry(nullptr) {}
+        ArchetypeEntity(EntityID id, ArchetypeRegistry* registry) : m_ID(id), m_Registry(registry) {}
+
+        EntityID GetID() const { return m_ID; }
+        bool IsValid() const { return m_ID != NULL_ENTITY && m_Registry != nullptr; }
+
+        template<typename T, typename... Args>
+        T& AddComponent(Args&&... args);
+
+        template<typename T>
+        T& GetComponent();
+
+        template<typename T>
+        const T& GetComponent() const;
+
+        template<typename T>
+        bool HasComponent() const;
+
+        template<typename T>
+        void RemoveComponent();
+
+        std::string ToString() const
+        {
+            return "Entity(" + std::to_string(GetEntityIndex(m_ID)) + "v" + std::to_string(GetEntityVersion(m_ID)) + ")";
+        }
+
+        bool operator==(const ArchetypeEntity& other) const { return m_ID == other.m_ID; }
+        bool operator!=(const ArchetypeEntity& other) const { return m_ID != other.m_ID; }
+        bool operator<(const ArchetypeEntity& other) const { return m_ID < other.m_ID; }
+
+    private:
+        EntityID m_ID;
+        ArchetypeRegistry* m_Registry;
+    };
+
+    template<typename TExclude, typename... TComponents>
+    class ArchetypeView;
+
+    // View over every archetype that contains all of TComponents and none of TExcluded.
+    // ForEach walks each matching chunk column by column, so iteration is a linear stream.
+    template<typename... TExcluded, typename... TComponents>
+    class ArchetypeView<ExcludeList<TExcluded...>, TComponents...>
+    {
+        static_assert(sizeof...(TComponents) > 0, "A view needs at least one component type");
+
+    public:
+        struct Match
+        {
+            Archetype* archetype;
+            std::array<size_t, sizeof...(TComponents)> columns;
+        };
+
+        ArchetypeView(ArchetypeRegistry* registry, std::vector<Match> matches)
+            : m_Registry(registry), m_Matches(std::move(matches)) {
+        }
+
+        class Iterator
+        {
+        public:
+            Iterator(const ArchetypeView* view, size_t match, size_t row)
+                : m_View(view), m_Match(match), m_Row(row)
+            {
+                SkipEmpty();
+            }
+
+            std::tuple<ArchetypeEntity, TComponents&...> operator*() const
+            {
+                return Dereference(std::index_sequence_for<TComponents...>{});
+            }
+
+            Iterator& operator++()
+            {
+                ++m_Row;
+                SkipEmpty();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const { return m_Match == other.m_Match && m_Row == other.m_Row; }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        private:
+            template<size_t... I>
+            std::tuple<ArchetypeEntity, TComponents&...> Dereference(std::index_sequence<I...>) const
+            {
+                const Match& match = m_View->m_Matches[m_Match];
+                return std::tuple<ArchetypeEntity, TComponents&...>(
+                    ArchetypeEntity(match.archetype->GetEntity(m_Row), m_View->m_Registry),
+                    *static_cast<TComponents*>(match.archetype->GetComponent(m_Row, match.columns[I]))...);
+            }
+
+            void SkipEmpty()
+            {
+                while (m_Match < m_View->m_Matches.size() && m_Row >= m_View->m_Matches[m_Match].archetype->GetEntityCount())
+                {
+                    ++m_Match;
+                    m_Row = 0;
+                }
+            }
+
+            const ArchetypeView* m_View;
+            size_t m_Match;
+            size_t m_Row;
+        };
+
+        Iterator begin() const { return Iterator(this, 0, 0); }
+        Iterator end() const { return Iterator(this, m_Matches.size(), 0); }
+
+        // Call func(ArchetypeEntity, TComponents&...) for every matching entity
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            for (const Match& match : m_Matches)
+            {
+                ForEachInArchetype(match, func, std::index_sequence_for<TComponents...>{});
+            }
+        }
+
+        // Number of matching entities
+        size_t SizeHint() const
+        {
+            size_t count = 0;
+            for (const Match& match : m_Matches)
+                count += match.archetype->GetEntityCount();
+            return count;
+        }
+
+    private:
+        template<typename Func, size_t... I>
+        void ForEachInArchetype(const Match& match, Func& func, std::index_sequence<I...>) const
+        {
+            Archetype* archetype = match.archetype;
+            for (size_t chunk = 0; chunk < archetype->GetChunkCount(); chunk++)
+            {
+                size_t count = archetype->GetChunkEntityCount(chunk);
+                const EntityID* entities = archetype->GetChunkEntities(chunk);
+                std::tuple<TComponents*...> columns(
+                    archetype->GetChunkColumn<std::remove_const_t<TComponents>>(chunk, match.columns[I])...);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    func(ArchetypeEntity(entities[i], m_Registry), std::get<I>(columns)[i]...);
+                }
+            }
+        }
+
+        ArchetypeRegistry* m_Registry;
+        std::vector<Match> m_Matches;
+    };
+
+    // Alternative to Registry that stores entities with the same component set together in
+    // fixed-size chunks (one contiguous column per component type). Systems that touch several
+    // components of many entities stream linearly through memory instead of hopping between
+    // separate ComponentStorage<T> arrays; the trade-off is that adding or removing a component
+    // moves the entity's whole row to another archetype.
+    //
+    // The entity/component/view API mirrors Registry (see EntityRegistry), so code templated on
+    // the registry type picks its backend at compile time. It is a side-by-side backend, not a
+    // mode of Registry: groups, hierarchy sorting, snapshots and the engine systems
+    // (TransformSystem, RenderSystem) work on ComponentStorage<T> directly and need a Registry.
+    class ArchetypeRegistry
+    {
+    public:
+        using EntityHandle = ArchetypeEntity;
+
+        ArchetypeRegistry()
+        {
+            m_EmptyArchetype = GetOrCreateArchetype({});
+        }
+        ~ArchetypeRegistry() = default;
+
+        ArchetypeRegistry(const ArchetypeRegistry&) = delete;
+        ArchetypeRegistry& operator=(const ArchetypeRegistry&) = delete;
+
+        // Entity management
+        ArchetypeEntity CreateEntity()
+        {
+            EntityID id = m_EntityPool.Create();
+
+            if (m_Locations.size() < m_EntityPool.GetIndexCount())
+            {
+                m_Locations.resize(m_EntityPool.GetIndexCount());
+            }
+
+            m_Locations[GetEntityIndex(id)] = { m_EmptyArchetype, m_EmptyArchetype->AllocateRow(id) };
+            return ArchetypeEntity(id, this);
+        }
+
+        void DestroyEntity(ArchetypeEntity entity)
+        {
+            if (!IsValidEntity(entity))
+                return;
+
+            EntityID id = entity.GetID();
+            EntityLocation& location = m_Locations[GetEntityIndex(id)];
+
+            EntityID movedEntity = location.archetype->RemoveRow(location.row);
+            if (movedEntity != NULL_ENTITY)
+                m_Locations[GetEntityIndex(movedEntity)].row = location.row;
+
+            location = {};
+            m_EntityPool.Destroy(id);
+        }
+
+        bool IsValidEntity(ArchetypeEntity entity) const
+        {
+            return m_EntityPool.IsAlive(entity.GetID());
+        }
+
+        // Component management
+        template<typename T, typename... Args>
+        T& AddComponent(ArchetypeEntity entity, Args&&... args)
+        {
+            if (!IsValidEntity(entity))
+                throw std::runtime_error("Invalid entity");
+
+            ComponentTypeID typeID = GetComponentTypeID<T>();
+            EntityLocation& location = m_Locations[GetEntityIndex(entity.GetID())];
+
+            // Return the existing component if present
+            size_t column = location.archetype->GetColumn(typeID);
+            if (column != Archetype::INVALID_COLUMN)
+                return *static_cast<T*>(location.archetype->GetComponent(location.row, column));
+
+            // Construct first so a throwing constructor leaves the entity untouched
+            T component(std::forward<Args>(args)...);
+
+            Archetype* destination = location.archetype->GetAddEdge(typeID);
+            if (!destination)
+            {
+                std::vector<const ComponentTypeInfo*> types = location.archetype->GetTypes();
+                types.push_back(&GetComponentTypeInfo<T>());
+                destination = GetOrCreateArchetype(std::move(types));
+                location.archetype->SetAddEdge(typeID, destination);
+                destination->SetRemoveEdge(typeID, location.archetype);
+            }
+
+            size_t row = MoveEntity(entity.GetID(), destination);
+            return *new (destination->GetComponent(row, destination->GetColumn(typeID))) T(std::move(component));
+        }
+
+        template<typename T>
+        T& GetComponent(ArchetypeEntity entity)
+        {
+            return const_cast<T&>(static_cast<const ArchetypeRegistry*>(this)->GetComponent<T>(entity));
+        }
+
+        template<typename T>
+        const T& GetComponent(ArchetypeEntity entity) const
+        {
+            if (!IsValidEntity(entity))
+                throw std::runtime_error("Invalid entity");
+
+            const EntityLocation& location = m_Locations[GetEntityIndex(entity.GetID())];
+            size_t column = location.archetype->GetColumn(GetComponentTypeID<T>());
+            if (column == Archetype::INVALID_COLUMN)
+                throw std::runtime_error("Entity does not have component");
+
+            return *static_cast<const T*>(location.archetype->GetComponent(location.row, column));
+        }
+
+        template<typename T>
+        bool HasComponent(ArchetypeEntity entity) const
+        {
+            return IsValidEntity(entity) && m_Locations[GetEntityIndex(entity.GetID())].archetype->HasType(GetComponentTypeID<T>());
+        }
+
+        template<typename T>
+        void RemoveComponent(ArchetypeEntity entity)
+        {
+            if (!HasComponent<T>(entity))
+                return;
+
+            ComponentTypeID typeID = GetComponentTypeID<T>();
+            EntityLocation& location = m_Locations[GetEntityIndex(entity.GetID())];
+
+            Archetype* destination = location.archetype->GetRemoveEdge(typeID);
+            if (!destination)
+            {
+                std::vector<const ComponentTypeInfo*> types;
+                for (const ComponentTypeInfo* type : location.archetype->GetTypes())
+                {
+                    if (type->id != typeID)
+                        types.push_back(type);
+                }
+                destination = GetOrCreateArchetype(std::move(types));
+                location.archetype->SetRemoveEdge(typeID, destination);
+                destination->SetAddEdge(typeID, location.archetype);
+            }
+
+            MoveEntity(entity.GetID(), destination);
+        }
+
+        // View over entities with all of TComponents and none of the excluded types
+        template<typename... TComponents, typename... TExcluded>
+        ArchetypeView<ExcludeList<TExcluded...>, TComponents...> View(ExcludeList<TExcluded...> = {})
+        {
+            using ViewType = ArchetypeView<ExcludeList<TExcluded...>, TComponents...>;
+            std::vector<typename ViewType::Match> matches;
+
+            ComponentSignature required;
+            (required.set(GetComponentTypeID<TComponents>()), ...);
+            ComponentSignature excluded;
+            (excluded.set(GetComponentTypeID<TExcluded>()), ...);
+
+            for (auto& pair : m_Archetypes)
+            {
+                Archetype* archetype = pair.second.get();
+                const ComponentSignature& signature = archetype->GetSignature();
+                if ((signature & required) != required || (signature & excluded).any())
+                    continue;
+
+                matches.push_back({ archetype, { archetype->GetColumn(GetComponentTypeID<TComponents>())... } });
+            }
+
+            return ViewType(this, std::move(matches));
+        }
+
+        template<typename T>
+        ArchetypeView<ExcludeList<>, T> GetView()
+        {
+            return View<T>();
+        }
+
+        size_t GetArchetypeCount() const { return m_Archetypes.size(); }
+
+    private:
+        struct EntityLocation
+        {
+            Archetype* archetype = nullptr;
+            size_t row = 0;
+        };
+
+        Archetype* GetOrCreateArchetype(std::vector<const ComponentTypeInfo*> types)
+        {
+            ComponentSignature key;
+            for (const ComponentTypeInfo* type : types)
+                key.set(type->id);
+
+            auto it = m_Archetypes.find(key);
+            if (it != m_Archetypes.end())
+                return it->second.get();
+
+            auto archetype = std::make_unique<Archetype>(std::move(types));
+            Archetype* rawPtr = archetype.get();
+            m_Archetypes.emplace(std::move(key), std::move(archetype));
+            return rawPtr;
+        }
+
+        // Move an entity's row into another archetype and fix up the locations it affects
+        size_t MoveEntity(EntityID id, Archetype* destination)
+        {
+            EntityLocation& location = m_Locations[GetEntityIndex(id)];
+
+            EntityID movedEntity = NULL_ENTITY;
+            size_t row = location.archetype->MoveRow(location.row, *destination, movedEntity);
+            if (movedEntity != NULL_ENTITY)
+                m_Locations[GetEntityIndex(movedEntity)].row = location.row;
+
+            location = { destination, row };
+            return row;
+        }
+
+    private:
+        EntityPool m_EntityPool;
+        std::vector<EntityLocation> m_Locations;       // Archetype and row, per entity index
+        std::unordered_map<ComponentSignature, std::unique_ptr<Archetype>> m_Archetypes;
+        Archetype* m_EmptyArchetype;
+    };
+
+    // Implementation of ArchetypeEntity's template methods
+    template<typename T, typename... Args>
+    T& ArchetypeEntity::AddComponent(Args&&... args)
+    {
+        return m_Registry->AddComponent<T>(*this, std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    T& ArchetypeEntity::GetComponent()
+    {
+        return m_Registry->GetComponent<T>(*this);
+    }
+
+    template<typename T>
+    const T& ArchetypeEntity::GetComponent() const
+    {
+        return static_cast<const ArchetypeRegistry*>(m_Registry)->GetComponent<T>(*this);
+    }
+
+    template<typename T>
+    bool ArchetypeEntity::HasComponent() const
+    {
+        return m_Registry->HasComponent<T>(*this);
+    }
+
+    template<typename T>
+    void ArchetypeEntity::RemoveComponent()
+    {
+        m_Registry->RemoveComponent<T>(*this);
+    }
+
+    static_assert(EntityRegistry<ArchetypeRegistry>);
+}
@@ -1,9 +1,15 @@
 #pragma once
 #include "Types.h"
 #include "Entity.h"
+#include "MemoryStats.h"
+#include "Core/Delegate.h"
 #include <vector>
-#include <unordered_map>
 #include <memory>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>  // Added this include
 
 namespace Nexus
@@ -15,100 +21,319 @@ namespace Nexus
         virtual ~Component() = default;
     };
 
+    class ComponentStorageBase;
+
+    // Lifecycle signal of a component storage: listeners get the registry and the entity
+    using ComponentSignal = Signal<void(Registry&, Entity)>;
+
+    // Changes to one component type between two frames of a RegistryHistory: the entities
+    // whose component was removed, and the entities whose component was added or written
+    // along with the new values (in ComponentDelta<T>).
+    class ComponentDeltaBase
+    {
+    public:
+        virtual ~ComponentDeltaBase() = default;
+
+        // Empty storage of the delta's type, for registries that do not have one yet
+        virtual std::unique_ptr<ComponentStorageBase> CreateStorage(Registry* registry,
+            const std::atomic<Tick>* tickSource, std::pmr::memory_resource* resource) const = 0;
+        virtual size_t GetMemoryBytes() const = 0;
+
+        bool IsEmpty() const { return removed.empty() && written.empty(); }
+
+        std::vector<EntityID> removed;
+        std::vector<EntityID> written;
+    };
+
+    template<typename T>
+    class ComponentDelta;
+
     // Abstract base for component storage
     class ComponentStorageBase
     {
     public:
         virtual ~ComponentStorageBase() = default;
         virtual void RemoveComponent(EntityID entity) = 0;
+        virtual void RemoveComponents(std::span<const EntityID> entities) = 0;
         virtual bool HasComponent(EntityID entity) const = 0;
         virtual size_t GetComponentCount() const = 0;
+        virtual StorageMemoryStats GetMemoryStats() const = 0;
+
+        virtual ComponentSignal& OnConstruct() = 0;
+        virtual ComponentSignal& OnUpdate() = 0;
+        virtual ComponentSignal& OnDestroy() = 0;
+
+        // Copying, for Registry::Clone and RegistryHistory. CopyFrom replaces the contents with
+        // other's (same component type), ticks included; signals and group stay as they are.
+        virtual std::unique_ptr<ComponentStorageBase> Clone(Registry* registry, const std::atomic<Tick>* tickSource,
+            std::pmr::memory_resource* resource) const = 0;
+        virtual void CopyFrom(const ComponentStorageBase& other) = 0;
+        virtual void Clear() = 0;
+        virtual void MarkAllChanged() = 0;
+
+        // Components changed after sinceTick or added since (added lists entities given the
+        // component since then, which tag storages need as they keep no ticks). A sinceTick
+        // of 0 captures every component.
+        virtual std::unique_ptr<ComponentDeltaBase> CaptureChanges(Tick sinceTick, std::span<const EntityID> added) const = 0;
+
+        // Add or overwrite the delta's written components (OnConstruct/OnUpdate fire); removals
+        // and entity signatures are up to the Registry
+        virtual void ApplyChanges(const ComponentDeltaBase& delta) = 0;
+    };
+
+    // How ComponentStorage::Sort orders the packed arrays
+    enum class SortAlgorithm
+    {
+        Default,    // O(n log n), for a first sort or large changes
+        Insertion   // O(n) when already nearly sorted, e.g. re-sorting after a few keys changed
+    };
+
+    // Keeps entities that have every component of an owning group packed at [0, n) of each
+    // owned storage. Owned storages notify it after adding and before removing a component.
+    class OwningGroupBase
+    {
+    public:
+        virtual ~OwningGroupBase() = default;
+        virtual void OnAdd(EntityID entity) = 0;
+        virtual void OnRemove(EntityID entity) = 0;
+        virtual void Rebuild() = 0;
     };
 
     // Templated component storage - stores components of type T
+    // Components and their owning entities live in packed, parallel arrays. A paged sparse
+    // array maps an entity index to its packed index, so lookups are two array reads instead of
+    // a hash probe. Pages are allocated lazily the first time an entity in their range is added.
+    // The sparse array is keyed by index only; the Registry rejects stale IDs before they get here.
+    // Every array and sparse page is allocated from the memory resource given at construction.
+    //
+    // Two more parallel arrays hold the tick each component was added and last changed at.
+    // Adding stamps both; non-const access (GetComponent, GetComponentUnchecked) stamps the
+    // changed tick. Writes through GetComponents() are not tracked, use MarkChanged for those.
+    //
+    // OnConstruct fires after a component is added, OnDestroy before it is removed, and
+    // OnUpdate when the Registry patches or replaces it. A signal without listeners costs one
+    // empty check. Listeners must not add or remove components of this storage's type.
     template<typename T>
-    class ComponentStorage : public ComponentStorageBase
+    class ComponentStorage final : public ComponentStorageBase
     {
     public:
-        ComponentStorage() = default;
-        ~ComponentStorage() = default;
+        explicit ComponentStorage(Registry* registry = nullptr, const std::atomic<Tick>* tickSource = nullptr,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : m_Components(resource), m_Entities(resource), m_Sparse(resource), m_AddedTicks(resource), m_ChangedTicks(resource),
+              m_Registry(registry), m_TickSource(tickSource ? tickSource : &NULL_TICK_SOURCE)
+        {
+        }
 
-        // Add component for entity
-        T& AddComponent(EntityID entity)
+        ~ComponentStorage()
         {
-            // Check if entity already has this component
-            auto it = m_EntityToIndex.find(entity);
-            if (it != m_EntityToIndex.end())
+            for (ComponentIndex* page : m_Sparse)
             {
-                return m_Components[it->second];
+                if (page)
+                    GetMemoryResource()->deallocate(page, SPARSE_PAGE_SIZE * sizeof(ComponentIndex), alignof(ComponentIndex));
             }
+        }
 
-            // Add new component
-            size_t index = m_Components.size();
-            m_Components.emplace_back();
-            m_Entities.push_back(entity);
-            m_EntityToIndex[entity] = index;
+        ComponentStorage(const ComponentStorage&) = delete;
+        ComponentStorage& operator=(const ComponentStorage&) = delete;
 
-            return m_Components.back();
-        }
+        // Resource every array of this storage allocates from
+        std::pmr::memory_resource* GetMemoryResource() const { return m_Components.get_allocator().resource(); }
 
-        // Add component with constructor arguments
+        // Add component for entity (forwards constructor arguments, returns the existing one if present)
         template<typename... Args>
         T& AddComponent(EntityID entity, Args&&... args)
         {
-            // Check if entity already has this component
-            auto it = m_EntityToIndex.find(entity);
-            if (it != m_EntityToIndex.end())
+            ComponentIndex& slot = AssureSparseSlot(entity);
+            if (slot != INVALID_COMPONENT_INDEX)
             {
-                return m_Components[it->second];
+                return m_Components[slot];
             }
 
             // Add new component with arguments
-            size_t index = m_Components.size();
             m_Components.emplace_back(std::forward<Args>(args)...);
             m_Entities.push_back(entity);
-            m_EntityToIndex[entity] = index;
+            Tick tick = GetCurrentTick();
+            m_AddedTicks.push_back(tick);
+            m_ChangedTicks.push_back(tick);
+            slot = m_Components.size() - 1;
+
+            if (m_Group || !m_OnConstruct.IsEmpty())
+            {
+                // The group may move the new component into its packed range
+                if (m_Group)
+                    m_Group->OnAdd(entity);
+                if (!m_OnConstruct.IsEmpty())
+                    m_OnConstruct.Publish(*m_Registry, Entity(entity, m_Registry));
+                return m_Components[SparseSlot(entity)];
+            }
 
             return m_Components.back();
         }
 
-        // Get component for entity
+        // Add a copy of prototype for every entity that does not have the component yet.
+        // Storage grows once and the new components are appended as one contiguous block.
+        void AddComponents(std::span<const Entity> entities, const T& prototype)
+        {
+            size_t first = m_Entities.size();
+            Reserve(m_Entities.size() + entities.size());
+
+            for (const Entity& entity : entities)
+            {
+                ComponentIndex& slot = AssureSparseSlot(entity.GetID());
+                if (slot != INVALID_COMPONENT_INDEX)
+                    continue;
+
+                slot = m_Entities.size();
+                m_Entities.push_back(entity.GetID());
+            }
+
+            m_Components.resize(m_Entities.size(), prototype);
+            StampNewComponents();
+            NotifyBulkAdd(first);
+        }
+
+        // Add components[i] for entities[i]; entities that already have the component keep theirs.
+        // While every entity is new the components are appended with a single range insert.
+        void AddComponents(std::span<const Entity> entities, std::span<const T> components)
+        {
+            size_t first = m_Entities.size();
+            Reserve(m_Entities.size() + entities.size());
+
+            size_t i = 0;
+            for (; i < entities.size(); i++)
+            {
+                ComponentIndex& slot = AssureSparseSlot(entities[i].GetID());
+                if (slot != INVALID_COMPONENT_INDEX)
+                    break;
+
+                slot = m_Entities.size();
+                m_Entities.push_back(entities[i].GetID());
+            }
+            m_Components.insert(m_Components.end(), components.begin(), components.begin() + i);
+
+            // Slow path after the first entity that already had the component
+            for (; i < entities.size(); i++)
+            {
+                ComponentIndex& slot = AssureSparseSlot(entities[i].GetID());
+                if (slot != INVALID_COMPONENT_INDEX)
+                    continue;
+
+                slot = m_Entities.size();
+                m_Entities.push_back(entities[i].GetID());
+                m_Components.push_back(components[i]);
+            }
+            StampNewComponents();
+            NotifyBulkAdd(first);
+        }
+
+        // Fill an empty storage with components[i] for entities[i] (distinct entities).
+        // The packed arrays are taken over as they are (without a copy when they use this
+        // storage's memory resource) and the sparse pages are written in one pass, which is how
+        // snapshots are restored.
+        void Assign(std::pmr::vector<EntityID>&& entities, std::pmr::vector<T>&& components)
+        {
+            if (!m_Entities.empty())
+                throw std::runtime_error("Can only assign to an empty component storage");
+            if (entities.size() != components.size())
+                throw std::runtime_error("Entity and component counts differ");
+
+            m_Entities = std::move(entities);
+            m_Components = std::move(components);
+            StampNewComponents();
+
+            for (size_t i = 0; i < m_Entities.size(); i++)
+            {
+                AssureSparseSlot(m_Entities[i]) = i;
+            }
+            NotifyBulkAdd(0);
+        }
+
+        // Reserve packed storage for at least capacity components
+        void Reserve(size_t capacity)
+        {
+            m_Components.reserve(capacity);
+            m_Entities.reserve(capacity);
+            m_AddedTicks.reserve(capacity);
+            m_ChangedTicks.reserve(capacity);
+        }
+
+        // Get component for entity (marks it changed)
         T& GetComponent(EntityID entity)
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end())
+            ComponentIndex index = GetIndex(entity);
+            if (index == INVALID_COMPONENT_INDEX)
             {
                 throw std::runtime_error("Entity does not have component");
             }
-            return m_Components[it->second];
+            m_ChangedTicks[index] = GetCurrentTick();
+            return m_Components[index];
         }
 
         const T& GetComponent(EntityID entity) const
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end())
+            ComponentIndex index = GetIndex(entity);
+            if (index == INVALID_COMPONENT_INDEX)
             {
                 throw std::runtime_error("Entity does not have component");
             }
-            return m_Components[it->second];
+            return m_Components[index];
+        }
+
+        // Get component for an entity that is known to have one (no presence check).
+        // The non-const overload marks the component changed.
+        T& GetComponentUnchecked(EntityID entity)
+        {
+            ComponentIndex index = SparseSlot(entity);
+            m_ChangedTicks[index] = GetCurrentTick();
+            return m_Components[index];
+        }
+
+        const T& GetComponentUnchecked(EntityID entity) const
+        {
+            return m_Components[SparseSlot(entity)];
         }
 
+        // Stamp the entity's component as changed at the current tick
+        void MarkChanged(EntityID entity)
+        {
+            ComponentIndex index = GetIndex(entity);
+            if (index != INVALID_COMPONENT_INDEX)
+                m_ChangedTicks[index] = GetCurrentTick();
+        }
+
+        // Ticks of an entity that is known to have the component
+        Tick GetAddedTick(EntityID entity) const { return m_AddedTicks[SparseSlot(entity)]; }
+        Tick GetChangedTick(EntityID entity) const { return m_ChangedTicks[SparseSlot(entity)]; }
+
         // Check if entity has component
         bool HasComponent(EntityID entity) const override
         {
-            return m_EntityToIndex.find(entity) != m_EntityToIndex.end();
+            return GetIndex(entity) != INVALID_COMPONENT_INDEX;
         }
 
         // Remove component for entity
         void RemoveComponent(EntityID entity) override
         {
-            auto it = m_EntityToIndex.find(entity);
-            if (it == m_EntityToIndex.end())
+            ComponentIndex indexToRemove = GetIndex(entity);
+            if (indexToRemove == INVALID_COMPONENT_INDEX)
             {
                 return; // Entity doesn't have this component
             }
 
-            size_t indexToRemove = it->second;
+            if (!m_OnDestroy.IsEmpty())
+            {
+                // Listeners still see the component
+                m_OnDestroy.Publish(*m_Registry, Entity(entity, m_Registry));
+                indexToRemove = SparseSlot(entity);
+            }
+
+            if (m_Group)
+            {
+                // Leave the group's packed range first; this may move the component
+                m_Group->OnRemove(entity);
+                indexToRemove = SparseSlot(entity);
+            }
+
             size_t lastIndex = m_Components.size() - 1;
 
             // If not the last element, move last element to this position
@@ -116,24 +341,673 @@ namespace Nexus
             {
                 m_Components[indexToRemove] = std::move(m_Components[lastIndex]);
                 m_Entities[indexToRemove] = m_Entities[lastIndex];
-                m_EntityToIndex[m_Entities[indexToRemove]] = indexToRemove;
+                m_AddedTicks[indexToRemove] = m_AddedTicks[lastIndex];
+                m_ChangedTicks[indexToRemove] = m_ChangedTicks[lastIndex];
+                SparseSlot(m_Entities[indexToRemove]) = indexToRemove;
             }
 
             // Remove last element
             m_Components.pop_back();
             m_Entities.pop_back();
-            m_EntityToIndex.erase(entity);
+            m_AddedTicks.pop_back();
+            m_ChangedTicks.pop_back();
+            SparseSlot(entity) = INVALID_COMPONENT_INDEX;
+        }
+
+        // Remove the component from every listed entity that has one
+        void RemoveComponents(std::span<const EntityID> entities) override
+        {
+            for (EntityID entity : entities)
+            {
+                RemoveComponent(entity);
+            }
+        }
+
+        // Swap two packed entries (component, entity, ticks) and fix up the sparse mapping
+        void SwapEntries(size_t a, size_t b)
+        {
+            if (a == b)
+                return;
+
+            std::swap(m_Components[a], m_Components[b]);
+            std::swap(m_Entities[a], m_Entities[b]);
+            std::swap(m_AddedTicks[a], m_AddedTicks[b]);
+            std::swap(m_ChangedTicks[a], m_ChangedTicks[b]);
+            SparseSlot(m_Entities[a]) = a;
+            SparseSlot(m_Entities[b]) = b;
+        }
+
+        // Sort the packed arrays so that compare(a, b) holds for components a before b.
+        // Entities, ticks and the sparse mapping move with their components.
+        template<typename Compare>
+        void Sort(Compare compare, SortAlgorithm algorithm = SortAlgorithm::Default)
+        {
+            size_t count = m_Components.size();
+
+            if (algorithm == SortAlgorithm::Insertion)
+            {
+                for (size_t i = 1; i < count; i++)
+                {
+                    // Find where element i belongs, then rotate it into place in every array
+                    size_t j = i;
+                    while (j > 0 && compare(m_Components[i], m_Components[j - 1]))
+                        j--;
+
+                    if (j != i)
+                        RotateEntry(i, j);
+                }
+                return;
+            }
+
+            // Sort a permutation, then apply it in place one cycle at a time
+            std::vector<size_t> order(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(),
+                [this, &compare](size_t a, size_t b) { return compare(m_Components[a], m_Components[b]); });
+
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t current = i;
+                while (order[current] != i)
+                {
+                    size_t next = order[current];
+                    SwapEntries(current, next);
+                    order[current] = current;
+                    current = next;
+                }
+                order[current] = current;
+            }
+        }
+
+        // Reorder so that entities also present in other come first, in other's order
+        template<typename U>
+        void SortAs(const ComponentStorage<U>& other)
+        {
+            size_t position = 0;
+            for (EntityID entity : other.GetEntities())
+            {
+                ComponentIndex index = GetIndex(entity);
+                if (index != INVALID_COMPONENT_INDEX && other.HasComponent(entity))
+                    SwapEntries(index, position++);
+            }
+        }
+
+        // Stamp packed entries [begin, end) as changed (bulk writes through GetComponents())
+        void MarkChangedRange(size_t begin, size_t end)
+        {
+            std::fill(m_ChangedTicks.begin() + begin, m_ChangedTicks.begin() + end, GetCurrentTick());
+        }
+
+        StorageMemoryStats GetMemoryStats() const override
+        {
+            StorageMemoryStats stats;
+            stats.typeName = GetTypeName<T>();
+            stats.typeID = GetComponentTypeID<T>();
+            stats.elementSize = sizeof(T);
+            stats.count = m_Components.size();
+            stats.capacity = m_Components.capacity();
+            stats.componentBytes = m_Components.capacity() * sizeof(T);
+            stats.entityBytes = m_Entities.capacity() * sizeof(EntityID);
+            stats.tickBytes = (m_AddedTicks.capacity() + m_ChangedTicks.capacity()) * sizeof(Tick);
+            stats.wastedBytes = (m_Components.capacity() - m_Components.size()) * sizeof(T) +
+                (m_Entities.capacity() - m_Entities.size()) * sizeof(EntityID) +
+                (m_AddedTicks.capacity() + m_ChangedTicks.capacity() - 2 * m_AddedTicks.size()) * sizeof(Tick);
+
+            stats.sparsePages = std::count_if(m_Sparse.begin(), m_Sparse.end(), [](const auto& page) { return page != nullptr; });
+            stats.indexBytes = m_Sparse.capacity() * sizeof(m_Sparse[0]) + stats.sparsePages * SPARSE_PAGE_SIZE * sizeof(ComponentIndex);
+            if (stats.sparsePages > 0)
+                stats.fragmentation = 1.0 - double(m_Entities.size()) / double(stats.sparsePages * SPARSE_PAGE_SIZE);
+            return stats;
+        }
+
+        // Lifecycle signals
+        ComponentSignal& OnConstruct() override { return m_OnConstruct; }
+        ComponentSignal& OnUpdate() override { return m_OnUpdate; }
+        ComponentSignal& OnDestroy() override { return m_OnDestroy; }
+
+        std::unique_ptr<ComponentStorageBase> Clone(Registry* registry, const std::atomic<Tick>* tickSource,
+            std::pmr::memory_resource* resource) const override
+        {
+            auto clone = std::make_unique<ComponentStorage>(registry, tickSource, resource);
+            clone->CopyFrom(*this);
+            return clone;
+        }
+
+        // Copy the packed arrays (a bulk copy for trivially copyable T) and the sparse pages
+        void CopyFrom(const ComponentStorageBase& other) override
+        {
+            if constexpr (std::is_copy_assignable_v<T>)
+            {
+                const auto& source = static_cast<const ComponentStorage&>(other);
+                m_Components = source.m_Components;
+                m_Entities = source.m_Entities;
+                m_AddedTicks = source.m_AddedTicks;
+                m_ChangedTicks = source.m_ChangedTicks;
+
+                if (m_Sparse.size() < source.m_Sparse.size())
+                    m_Sparse.resize(source.m_Sparse.size());
+                for (size_t page = 0; page < m_Sparse.size(); page++)
+                {
+                    const ComponentIndex* sourcePage = page < source.m_Sparse.size() ? source.m_Sparse[page] : nullptr;
+                    if (sourcePage)
+                        std::copy_n(sourcePage, SPARSE_PAGE_SIZE, AssureSparsePage(page));
+                    else if (m_Sparse[page])
+                        std::fill_n(m_Sparse[page], SPARSE_PAGE_SIZE, INVALID_COMPONENT_INDEX);
+                }
+            }
+            else
+            {
+                throw std::runtime_error("Component type cannot be copied");
+            }
+        }
+
+        // Remove every component without notifying anyone; memory is kept for reuse
+        void Clear() override
+        {
+            m_Components.clear();
+            m_Entities.clear();
+            m_AddedTicks.clear();
+            m_ChangedTicks.clear();
+            for (ComponentIndex* page : m_Sparse)
+            {
+                if (page)
+                    std::fill_n(page, SPARSE_PAGE_SIZE, INVALID_COMPONENT_INDEX);
+            }
+        }
+
+        void MarkAllChanged() override { MarkChangedRange(0, m_ChangedTicks.size()); }
+
+        std::unique_ptr<ComponentDeltaBase> CaptureChanges(Tick sinceTick, std::span<const EntityID>) const override
+        {
+            auto delta = std::make_unique<ComponentDelta<T>>();
+            if constexpr (std::is_copy_constructible_v<T>)
+            {
+                // Adding stamps the changed tick too, so one pass finds both
+                for (size_t i = 0; i < m_ChangedTicks.size(); i++)
+                {
+                    if (m_ChangedTicks[i] > sinceTick)
+                    {
+                        delta->written.push_back(m_Entities[i]);
+                        delta->values.push_back(m_Components[i]);
+                    }
+                }
+            }
+            else
+            {
+                throw std::runtime_error("Component type cannot be copied");
+            }
+            return delta;
+        }
+
+        void ApplyChanges(const ComponentDeltaBase& base) override
+        {
+            if constexpr (std::is_copy_assignable_v<T>)
+            {
+                const auto& delta = static_cast<const ComponentDelta<T>&>(base);
+                for (size_t i = 0; i < delta.written.size(); i++)
+                {
+                    EntityID entity = delta.written[i];
+                    ComponentIndex index = GetIndex(entity);
+                    if (index == INVALID_COMPONENT_INDEX)
+                    {
+                        AddComponent(entity, delta.values[i]);
+                        continue;
+                    }
+
+                    m_Components[index] = delta.values[i];
+                    m_ChangedTicks[index] = GetCurrentTick();
+                    if (!m_OnUpdate.IsEmpty())
+                        m_OnUpdate.Publish(*m_Registry, Entity(entity, m_Registry));
+                }
+            }
+            else
+            {
+                throw std::runtime_error("Component type cannot be copied");
+            }
+        }
+
+        // Owning group that controls this storage's order, if any
+        OwningGroupBase* GetGroup() const { return m_Group; }
+        void SetGroup(OwningGroupBase* group) { m_Group = group; }
+
+        // Packed index of the entity's component, or INVALID_COMPONENT_INDEX
+        ComponentIndex GetIndex(EntityID entity) const
+        {
+            EntityID index = GetEntityIndex(entity);
+            size_t page = index / SPARSE_PAGE_SIZE;
+            if (page >= m_Sparse.size() || !m_Sparse[page])
+            {
+                return INVALID_COMPONENT_INDEX;
+            }
+            return m_Sparse[page][index % SPARSE_PAGE_SIZE];
         }
 
         // Get all components and entities (for iteration)
-        const std::vector<T>& GetComponents() const { return m_Components; }
-        const std::vector<EntityID>& GetEntities() const { return m_Entities; }
+        std::pmr::vector<T>& GetComponents() { return m_Components; }
+        const std::pmr::vector<T>& GetComponents() const { return m_Components; }
+        const std::pmr::vector<EntityID>& GetEntities() const { return m_Entities; }
 
         size_t GetComponentCount() const override { return m_Components.size(); }
 
     private:
-        std::vector<T> m_Components;                    // Packed array of components
-        std::vector<EntityID> m_Entities;              // Parallel array of entity IDs
-        std::unordered_map<EntityID, size_t> m_EntityToIndex; // Map entity to component index
+
+        Tick GetCurrentTick() const { return m_TickSource->load(std::memory_order_relaxed); }
+
+        // Move the entry at index from down to index to, shifting [to, from) up by one
+        void RotateEntry(size_t from, size_t to)
+        {
+            std::rotate(m_Components.begin() + to, m_Components.begin() + from, m_Components.begin() + from + 1);
+            std::rotate(m_Entities.begin() + to, m_Entities.begin() + from, m_Entities.begin() + from + 1);
+            std::rotate(m_AddedTicks.begin() + to, m_AddedTicks.begin() + from, m_AddedTicks.begin() + from + 1);
+            std::rotate(m_ChangedTicks.begin() + to, m_ChangedTicks.begin() + from, m_ChangedTicks.begin() + from + 1);
+
+            for (size_t k = to; k <= from; k++)
+            {
+                SparseSlot(m_Entities[k]) = k;
+            }
+        }
+
+        // Tell the group and OnConstruct listeners about the components appended from packed index first
+        void NotifyBulkAdd(size_t first)
+        {
+            if (!m_Group && m_OnConstruct.IsEmpty())
+                return;
+
+            // The group reorders the packed arrays, so copy the new entities first
+            std::vector<EntityID> added(m_Entities.begin() + first, m_Entities.end());
+
+            if (m_Group)
+            {
+                // OnAdd ignores entities that still miss another owned component
+                for (EntityID entity : added)
+                {
+                    m_Group->OnAdd(entity);
+                }
+            }
+
+            for (EntityID entity : added)
+            {
+                m_OnConstruct.Publish(*m_Registry, Entity(entity, m_Registry));
+            }
+        }
+
+        void StampNewComponents()
+        {
+            Tick tick = GetCurrentTick();
+            m_AddedTicks.resize(m_Components.size(), tick);
+            m_ChangedTicks.resize(m_Components.size(), tick);
+        }
+
+        // Slot for an entity that is known to be present
+        ComponentIndex& SparseSlot(EntityID entity)
+        {
+            EntityID index = GetEntityIndex(entity);
+            return m_Sparse[index / SPARSE_PAGE_SIZE][index % SPARSE_PAGE_SIZE];
+        }
+
+        ComponentIndex SparseSlot(EntityID entity) const
+        {
+            EntityID index = GetEntityIndex(entity);
+            return m_Sparse[index / SPARSE_PAGE_SIZE][index % SPARSE_PAGE_SIZE];
+        }
+
+        // Slot for any entity, allocating its page on first use
+        ComponentIndex& AssureSparseSlot(EntityID entity)
+        {
+            EntityID index = GetEntityIndex(entity);
+            size_t page = index / SPARSE_PAGE_SIZE;
+            if (page >= m_Sparse.size())
+            {
+                m_Sparse.resize(page + 1);
+            }
+
+            return AssureSparsePage(page)[index % SPARSE_PAGE_SIZE];
+        }
+
+        // Page of the sparse array (which must have the slot), allocated on first use
+        ComponentIndex* AssureSparsePage(size_t page)
+        {
+            if (!m_Sparse[page])
+            {
+                void* memory = GetMemoryResource()->allocate(SPARSE_PAGE_SIZE * sizeof(ComponentIndex), alignof(ComponentIndex));
+                m_Sparse[page] = static_cast<ComponentIndex*>(memory);
+                std::fill_n(m_Sparse[page], SPARSE_PAGE_SIZE, INVALID_COMPONENT_INDEX);
+            }
+            return m_Sparse[page];
+        }
+
+    private:
+        std::pmr::vector<T> m_Components;               // Packed array of components
+        std::pmr::vector<EntityID> m_Entities;         // Parallel array of entity IDs
+        std::pmr::vector<ComponentIndex*> m_Sparse;    // Paged map from entity index to component index (null = no page)
+        std::pmr::vector<Tick> m_AddedTicks;           // Parallel array: tick the component was added at
+        std::pmr::vector<Tick> m_ChangedTicks;         // Parallel array: tick of the last mutable access
+        Registry* m_Registry;                          // Owner, passed to signal listeners
+        const std::atomic<Tick>* m_TickSource;         // Current tick (owned by the Registry)
+        OwningGroupBase* m_Group = nullptr;            // Owning group, keeps its entities at the front
+        ComponentSignal m_OnConstruct;
+        ComponentSignal m_OnUpdate;
+        ComponentSignal m_OnDestroy;
+    };
+
+    // Storage for empty (tag) components such as Static or Hidden, chosen automatically for
+    // every type without data. Membership is a bitset indexed by entity index, so HasComponent
+    // is a single bit test, and the members are also listed densely for iteration.
+    // Removing only clears the bit: the list drops stale entries lazily, in one pass once they
+    // make up half of it. Tagging a removed entity index again reuses its stale entry (found
+    // through a per-index position map), so toggling a tag is O(1). Views skip stale entries
+    // through the membership test they already do for every included storage.
+    // Tags are not change-tracked and cannot be sorted or owned by groups.
+    template<typename T>
+        requires std::is_empty_v<T>
+    class ComponentStorage<T> final : public ComponentStorageBase
+    {
+    public:
+        explicit ComponentStorage(Registry* registry = nullptr, const std::atomic<Tick>* = nullptr,
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : m_Entities(resource), m_Members(resource), m_Positions(resource), m_Registry(registry)
+        {
+        }
+
+        ComponentStorage(const ComponentStorage&) = delete;
+        ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+        std::pmr::memory_resource* GetMemoryResource() const { return m_Entities.get_allocator().resource(); }
+
+        // Tag an entity; all tags of a type share one instance
+        template<typename... Args>
+        T& AddComponent(EntityID entity, Args&&...)
+        {
+            if (HasComponent(entity))
+                return s_Instance;
+
+            // The index still has a stale entry (possibly with an older version): take it over
+            uint32_t position = GetPosition(GetEntityIndex(entity));
+            if (position != NOT_LISTED)
+            {
+                m_Entities[position] = entity;
+                SetBit(m_Members, GetEntityIndex(entity));
+                m_Count++;
+                m_StaleCount--;
+            }
+            else
+            {
+                Insert(entity);
+            }
+
+            if (!m_OnConstruct.IsEmpty())
+                m_OnConstruct.Publish(*m_Registry, Entity(entity, m_Registry));
+            return s_Instance;
+        }
+
+        void AddComponents(std::span<const Entity> entities, const T& = T())
+        {
+            if (m_StaleCount > 0)
+                Compact();
+
+            size_t first = m_Entities.size();
+            m_Entities.reserve(m_Entities.size() + entities.size());
+            for (const Entity& entity : entities)
+            {
+                if (!HasComponent(entity.GetID()))
+                    Insert(entity.GetID());
+            }
+            PublishConstructed(first);
+        }
+
+        void AddComponents(std::span<const Entity> entities, std::span<const T>)
+        {
+            AddComponents(entities);
+        }
+
+        // Fill an empty storage with the given (distinct) entities
+        void Assign(std::pmr::vector<EntityID>&& entities)
+        {
+            if (m_Count != 0 || m_StaleCount != 0)
+                throw std::runtime_error("Can only assign to an empty component storage");
+
+            m_Entities = std::move(entities);
+            for (size_t position = 0; position < m_Entities.size(); position++)
+            {
+                SetBit(m_Members, GetEntityIndex(m_Entities[position]));
+                SetPosition(GetEntityIndex(m_Entities[position]), position);
+            }
+            m_Count = m_Entities.size();
+            PublishConstructed(0);
+        }
+
+        void Reserve(size_t capacity) { m_Entities.reserve(capacity); }
+
+        T& GetComponent(EntityID entity)
+        {
+            if (!HasComponent(entity))
+                throw std::runtime_error("Entity does not have component");
+            return s_Instance;
+        }
+
+        const T& GetComponent(EntityID entity) const
+        {
+            if (!HasComponent(entity))
+                throw std::runtime_error("Entity does not have component");
+            return s_Instance;
+        }
+
+        T& GetComponentUnchecked(EntityID) { return s_Instance; }
+        const T& GetComponentUnchecked(EntityID) const { return s_Instance; }
+
+        bool HasComponent(EntityID entity) const override
+        {
+            return TestBit(m_Members, GetEntityIndex(entity));
+        }
+
+        void RemoveComponent(EntityID entity) override
+        {
+            if (!HasComponent(entity))
+                return;
+
+            if (!m_OnDestroy.IsEmpty())
+                m_OnDestroy.Publish(*m_Registry, Entity(entity, m_Registry));
+
+            ClearBit(m_Members, GetEntityIndex(entity));
+            m_Count--;
+            m_StaleCount++;
+            if (m_StaleCount * 2 > m_Entities.size())
+                Compact();
+        }
+
+        void RemoveComponents(std::span<const EntityID> entities) override
+        {
+            for (EntityID entity : entities)
+            {
+                RemoveComponent(entity);
+            }
+        }
+
+        size_t GetComponentCount() const override { return m_Count; }
+
+        // Tagged entities, possibly with stale entries in between (check HasComponent)
+        const std::pmr::vector<EntityID>& GetEntities() const { return m_Entities; }
+
+        // Tags carry no data: they never count as changed, and pass every tick filter
+        void MarkChanged(EntityID) {}
+        Tick GetAddedTick(EntityID) const { return std::numeric_limits<Tick>::max(); }
+        Tick GetChangedTick(EntityID) const { return std::numeric_limits<Tick>::max(); }
+
+        OwningGroupBase* GetGroup() const { return nullptr; }
+
+        StorageMemoryStats GetMemoryStats() const override
+        {
+            StorageMemoryStats stats;
+            stats.typeName = GetTypeName<T>();
+            stats.typeID = GetComponentTypeID<T>();
+            stats.elementSize = 0;
+            stats.count = m_Count;
+            stats.capacity = m_Entities.capacity();
+            stats.entityBytes = m_Entities.capacity() * sizeof(EntityID);
+            stats.indexBytes = m_Members.capacity() * sizeof(uint64_t) + m_Positions.capacity() * sizeof(uint32_t);
+            stats.wastedBytes = (m_Entities.capacity() - m_Count) * sizeof(EntityID);
+            if (!m_Entities.empty())
+                stats.fragmentation = double(m_StaleCount) / double(m_Entities.size());
+            return stats;
+        }
+
+        // Lifecycle signals (OnUpdate fires for Patch/Replace like for any component)
+        ComponentSignal& OnConstruct() override { return m_OnConstruct; }
+        ComponentSignal& OnUpdate() override { return m_OnUpdate; }
+        ComponentSignal& OnDestroy() override { return m_OnDestroy; }
+
+        std::unique_ptr<ComponentStorageBase> Clone(Registry* registry, const std::atomic<Tick>* tickSource,
+            std::pmr::memory_resource* resource) const override
+        {
+            auto clone = std::make_unique<ComponentStorage>(registry, tickSource, resource);
+            clone->CopyFrom(*this);
+            return clone;
+        }
+
+        void CopyFrom(const ComponentStorageBase& other) override
+        {
+            const auto& source = static_cast<const ComponentStorage&>(other);
+            m_Entities = source.m_Entities;
+            m_Members = source.m_Members;
+            m_Positions = source.m_Positions;
+            m_Count = source.m_Count;
+            m_StaleCount = source.m_StaleCount;
+        }
+
+        void Clear() override
+        {
+            m_Entities.clear();
+            std::fill(m_Members.begin(), m_Members.end(), uint64_t(0));
+            std::fill(m_Positions.begin(), m_Positions.end(), NOT_LISTED);
+            m_Count = 0;
+            m_StaleCount = 0;
+        }
+
+        void MarkAllChanged() override {}
+
+        // Tags have no ticks: the entities tagged since (and still tagged) are the changes
+        std::unique_ptr<ComponentDeltaBase> CaptureChanges(Tick sinceTick, std::span<const EntityID> added) const override
+        {
+            auto delta = std::make_unique<ComponentDelta<T>>();
+            for (EntityID entity : sinceTick == 0 ? std::span<const EntityID>(m_Entities) : added)
+            {
+                if (HasComponent(entity))
+                    delta->written.push_back(entity);
+            }
+            return delta;
+        }
+
+        void ApplyChanges(const ComponentDeltaBase& delta) override
+        {
+            for (EntityID entity : delta.written)
+            {
+                AddComponent(entity);
+            }
+        }
+
+    private:
+        void Insert(EntityID entity)
+        {
+            SetBit(m_Members, GetEntityIndex(entity));
+            SetPosition(GetEntityIndex(entity), m_Entities.size());
+            m_Entities.push_back(entity);
+            m_Count++;
+        }
+
+        void PublishConstructed(size_t first)
+        {
+            if (m_OnConstruct.IsEmpty())
+                return;
+
+            // Listeners may tag more entities, so walk a copy
+            std::vector<EntityID> added(m_Entities.begin() + first, m_Entities.end());
+            for (EntityID entity : added)
+            {
+                m_OnConstruct.Publish(*m_Registry, Entity(entity, m_Registry));
+            }
+        }
+
+        // Drop stale entries, keeping the order of the rest
+        void Compact()
+        {
+            size_t kept = 0;
+            for (EntityID entity : m_Entities)
+            {
+                if (!HasComponent(entity))
+                {
+                    m_Positions[GetEntityIndex(entity)] = NOT_LISTED;
+                    continue;
+                }
+                m_Positions[GetEntityIndex(entity)] = static_cast<uint32_t>(kept);
+                m_Entities[kept++] = entity;
+            }
+            m_Entities.resize(kept);
+            m_StaleCount = 0;
+        }
+
+        uint32_t GetPosition(EntityID index) const
+        {
+            return index < m_Positions.size() ? m_Positions[index] : NOT_LISTED;
+        }
+
+        void SetPosition(EntityID index, size_t position)
+        {
+            if (index >= m_Positions.size())
+                m_Positions.resize(std::max<size_t>(index + 1, m_Positions.size() * 2), NOT_LISTED);
+            m_Positions[index] = static_cast<uint32_t>(position);
+        }
+
+        static bool TestBit(const std::pmr::vector<uint64_t>& bits, EntityID index)
+        {
+            size_t word = index / 64;
+            return word < bits.size() && (bits[word] >> (index % 64)) & 1;
+        }
+
+        static void SetBit(std::pmr::vector<uint64_t>& bits, EntityID index)
+        {
+            size_t word = index / 64;
+            if (word >= bits.size())
+                bits.resize(std::max(word + 1, bits.size() * 2));
+            bits[word] |= uint64_t(1) << (index % 64);
+        }
+
+        static void ClearBit(std::pmr::vector<uint64_t>& bits, EntityID index)
+        {
+            bits[index / 64] &= ~(uint64_t(1) << (index % 64));
+        }
+
+        static constexpr uint32_t NOT_LISTED = UINT32_MAX;
+        static inline T s_Instance{};
+
+        std::pmr::vector<EntityID> m_Entities;         // Members (re-tagged ones keep their old slot), plus stale entries
+        std::pmr::vector<uint64_t> m_Members;          // Bit per entity index: has the tag
+        std::pmr::vector<uint32_t> m_Positions;        // Per entity index: its entry in m_Entities, or NOT_LISTED
+        size_t m_Count = 0;                            // Members
+        size_t m_StaleCount = 0;                       // Entries in m_Entities whose tag was removed
+        Registry* m_Registry;
+        ComponentSignal m_OnConstruct;
+        ComponentSignal m_OnUpdate;
+        ComponentSignal m_OnDestroy;
+    };
+
+    template<typename T>
+    class ComponentDelta final : public ComponentDeltaBase
+    {
+    public:
+        std::unique_ptr<ComponentStorageBase> CreateStorage(Registry* registry, const std::atomic<Tick>* tickSource,
+            std::pmr::memory_resource* resource) const override
+        {
+            return std::make_unique<ComponentStorage<T>>(registry, tickSource, resource);
+        }
+
+        size_t GetMemoryBytes() const override
+        {
+            return (removed.capacity() + written.capacity()) * sizeof(EntityID) + values.capacity() * sizeof(T);
+        }
+
+        std::vector<T> values;     // Parallel to written (empty for tags)
     };
-}
\ No newline at end of file
+}
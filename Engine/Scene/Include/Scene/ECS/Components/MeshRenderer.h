@@ -1,5 +1,7 @@
 #pragma once
+#include "Core/StringTable.h"
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 namespace Nexus
@@ -23,24 +25,25 @@ namespace Nexus
             : meshID(mesh), materialID(material) {
         }
 
-        // For now, using simple file paths (will be replaced with asset system)
-        std::string meshPath;       // Temporary: path to mesh file
-        std::string materialPath;   // Temporary: path to material file
+        // For now, using simple file paths (will be replaced with asset system).
+        // Interned, so every renderer of the same asset shares one copy of the path.
+        StringID meshPath;          // Temporary: path to mesh file
+        StringID materialPath;      // Temporary: path to material file
 
-        MeshRenderer(const std::string& mesh, const std::string& material)
+        MeshRenderer(std::string_view mesh, std::string_view material)
             : meshPath(mesh), materialPath(material) {
         }
 
         bool IsValid() const
         {
-            return meshID != 0 || !meshPath.empty();
+            return meshID != 0 || !meshPath.IsEmpty();
         }
 
         std::string ToString() const
         {
-            if (!meshPath.empty())
+            if (!meshPath.IsEmpty())
             {
-                return "MeshRenderer(mesh: " + meshPath + ", material: " + materialPath + ")";
+                return "MeshRenderer(mesh: " + meshPath.GetString() + ", material: " + materialPath.GetString() + ")";
             }
             return "MeshRenderer(meshID: " + std::to_string(meshID) +
                 ", materialID: " + std::to_string(materialID) + ")";
@@ -1,20 +1,26 @@
 #pragma once
+#include "Core/StringTable.h"
 #include <string>
+#include <string_view>
 
 namespace Nexus
 {
-    // Name component for entity identification
+    // Name component for entity identification. The name is interned; the Registry indexes
+    // entities by name (FindEntityByName), so rename with Registry::Patch or Replace.
     class Name
     {
     public:
-        std::string name;
+        StringID name;
 
         Name() : name("Entity") {}
-        Name(const std::string& entityName) : name(entityName) {}
+        Name(std::string_view entityName) : name(entityName) {}
+        Name(StringID entityName) : name(entityName) {}
+
+        const std::string& GetString() const { return name.GetString(); }
 
         std::string ToString() const
         {
-            return "Name(" + name + ")";
+            return "Name(" + name.GetString() + ")";
         }
     };
 
@@ -22,19 +28,23 @@ namespace Nexus
     class Tag
     {
     public:
-        std::string tag;
+        StringID tag;
 
         Tag() : tag("Untagged") {}
-        Tag(const std::string& entityTag) : tag(entityTag) {}
+        Tag(std::string_view entityTag) : tag(entityTag) {}
+        Tag(StringID entityTag) : tag(entityTag) {}
 
-        bool HasTag(const std::string& checkTag) const
+        // Integer compare; intern the tag once, e.g. static const StringID enemy("Enemy")
+        bool HasTag(StringID checkTag) const
         {
             return tag == checkTag;
         }
 
+        const std::string& GetString() const { return tag.GetString(); }
+
         std::string ToString() const
         {
-            return "Tag(" + tag + ")";
+            return "Tag(" + tag.GetString() + ")";
         }
     };
-}
\ No newline at end of file
+}
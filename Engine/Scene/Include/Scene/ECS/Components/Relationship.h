@@ -0,0 +1,24 @@
+#pragma once
+#include "../Types.h"
+
+namespace Nexus
+{
+    // Parent/child links of an entity in the scene hierarchy. Children form a doubly linked
+    // list through their sibling links, so the hierarchy needs no allocation per node and
+    // the component stays trivially copyable. Links are entity IDs (NULL_ENTITY for none).
+    //
+    // Edit links through Registry::SetParent only; the Registry also unlinks an entity when
+    // its Relationship is removed or it is destroyed (its children become roots).
+    class Relationship
+    {
+    public:
+        EntityID parent = NULL_ENTITY;
+        EntityID firstChild = NULL_ENTITY;
+        EntityID nextSibling = NULL_ENTITY;
+        EntityID prevSibling = NULL_ENTITY;
+        uint32_t childCount = 0;
+
+        bool IsRoot() const { return parent == NULL_ENTITY; }
+        bool HasChildren() const { return firstChild != NULL_ENTITY; }
+    };
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Nexus
+{
+    // Marker components without data. Empty types are stored as a membership bitset plus an
+    // entity list (see ComponentStorage), so testing for them costs a single bit test.
+
+    // Entity never moves; transform updates can skip it
+    class Static
+    {
+    };
+
+    // Entity is selected in the editor
+    class Selected
+    {
+    };
+
+    // Entity is not rendered
+    class Hidden
+    {
+    };
+}
@@ -2,9 +2,7 @@
 #include "Math/Vector3.h"
 #include "Math/Quaternion.h"
 #include "Math/Matrix4.h"
-#include "../Entity.h"
-#include <vector>
-#include <algorithm>
+#include <string>
 
 namespace Nexus
 {
@@ -16,14 +14,13 @@ namespace Nexus
         Quaternion rotation = Quaternion::Identity;
         Vector3 scale = Vector3::One;
 
-        // Hierarchy support
-        Entity parent = Entity::Null;
-        std::vector<Entity> children;
+        // Parent and children live in the Relationship component (see Registry::SetParent)
 
-        // Cached matrices (computed on demand)
+        // Cached matrices: the local one is computed on demand, the world one by TransformSystem
         mutable Matrix4 localMatrix;
         mutable Matrix4 worldMatrix;
-        mutable bool isDirty = true;
+        mutable bool isDirty = true;        // Local matrix is stale
+        mutable bool isWorldDirty = true;   // World matrix is stale (cleared by TransformSystem)
 
         // Constructors
         Transform() = default;
@@ -38,21 +35,27 @@ namespace Nexus
         {
             if (isDirty)
             {
-                // Compose TRS matrix: Translation * Rotation * Scale
-                Matrix4 T = Matrix4::Translate(position);
-                Matrix4 R = rotation.ToMatrix(); // You'll need to implement this in Quaternion
-                Matrix4 S = Matrix4::Scale(scale);
-
-                localMatrix = T * R * S;
+                // Translation * Rotation * Scale in closed form: the rotation's columns scaled,
+                // the translation in the last column (no general matrix products)
+                localMatrix = rotation.ToMatrix();
+                for (int row = 0; row < 3; row++)
+                {
+                    localMatrix[row] *= scale.x;
+                    localMatrix[row + 4] *= scale.y;
+                    localMatrix[row + 8] *= scale.z;
+                }
+                localMatrix[12] = position.x;
+                localMatrix[13] = position.y;
+                localMatrix[14] = position.z;
                 isDirty = false;
             }
             return localMatrix;
         }
 
+        // World matrix as of the last TransformSystem::Update
         const Matrix4& GetWorldMatrix() const
         {
-            // For now, return local matrix (hierarchy will be implemented later)
-            return GetLocalMatrix();
+            return worldMatrix;
         }
 
         // Transform operations
@@ -115,45 +118,12 @@ namespace Nexus
             return rotation * Vector3::Up;
         }
 
-        // Hierarchy management (basic for now)
-        void SetParent(Entity newParent)
-        {
-            // Remove from old parent's children
-            if (parent.IsValid())
-            {
-                // TODO: Remove from parent's children list
-            }
-
-            parent = newParent;
-
-            // Add to new parent's children
-            if (parent.IsValid())
-            {
-                // TODO: Add to parent's children list
-            }
-
-            MarkDirty();
-        }
-
-        void AddChild(Entity child)
-        {
-            children.push_back(child);
-        }
-
-        void RemoveChild(Entity child)
-        {
-            auto it = std::find(children.begin(), children.end(), child);
-            if (it != children.end())
-            {
-                children.erase(it);
-            }
-        }
-
         // Utility
+        // Children need no flag: TransformSystem recomputes every descendant of a dirty transform
         void MarkDirty() const
         {
             isDirty = true;
-            // TODO: Mark children dirty as well when hierarchy is fully implemented
+            isWorldDirty = true;
         }
 
         std::string ToString() const
@@ -162,11 +132,5 @@ namespace Nexus
                 ", rot: " + rotation.ToString() +
                 ", scale: " + scale.ToString() + ")";
         }
-
-    private:
-        std::vector<Entity>::iterator find(std::vector<Entity>& vec, const Entity& entity)
-        {
-            return std::find(vec.begin(), vec.end(), entity);
-        }
     };
 }
\ No newline at end of file
@@ -39,7 +39,7 @@ namespace Nexus
         // Utility
         std::string ToString() const
         {
-            return "Entity(" + std::to_string(m_ID) + ")";
+            return "Entity(" + std::to_string(GetEntityIndex(m_ID)) + "v" + std::to_string(GetEntityVersion(m_ID)) + ")";
         }
 
         // Comparison operators
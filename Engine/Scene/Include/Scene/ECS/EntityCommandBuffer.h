@@ -0,0 +1,149 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Registry.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nexus
+{
+    // Records structural changes (create, destroy, add, remove) so they can be applied later
+    // in one batched pass, e.g. after a view has finished iterating.
+    //
+    // Recording never touches the Registry, so each worker thread can fill its own buffer.
+    // Entities created through the buffer are placeholders that only become real entities at
+    // playback; they can be used as targets of later commands in the same buffer. Entities
+    // reserved with Registry::ReserveEntities have their final ID already and can be used in
+    // any buffer; playback flushes the reservations first.
+    //
+    // Playback order: creates, then adds/removes grouped by component type (so each storage
+    // is reserved and touched once, keeping recorded order within a type), then destroys.
+    // Commands that target an entity which is no longer alive at playback are dropped. Adding
+    // a T the entity already has replaces it, like Registry::Replace (OnUpdate is notified).
+    class EntityCommandBuffer
+    {
+    public:
+        EntityCommandBuffer() = default;
+        ~EntityCommandBuffer();
+
+        EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+        EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+        // Create a placeholder entity that becomes real at playback
+        Entity CreateEntity()
+        {
+            if (m_PlaceholderCount > ENTITY_INDEX_MASK)
+                throw std::runtime_error("Too many entities created in one command buffer");
+
+            EntityID placeholder = MakeEntityID(m_PlaceholderCount++, PLACEHOLDER_ENTITY_VERSION);
+            m_Commands.push_back({ CommandType::Create, 0, placeholder, nullptr, nullptr });
+            return Entity(placeholder, nullptr);
+        }
+
+        // Reserve count real entity IDs into this buffer with one atomic operation (see
+        // Registry::ReserveEntities); ReserveEntity hands them out and reserves exactly one
+        // more once they run out. IDs still unused when the buffer is played back, cleared or
+        // destroyed are released to registry, so the buffer must not outlive it.
+        void ReserveEntities(Registry& registry, size_t count);
+        Entity ReserveEntity(Registry& registry);
+
+        void DestroyEntity(Entity entity)
+        {
+            m_Commands.push_back({ CommandType::Destroy, 0, entity.GetID(), nullptr, nullptr });
+        }
+
+        // Record adding a component constructed from args (constructed now, moved in at playback)
+        template<typename T, typename... Args>
+        void AddComponent(Entity entity, Args&&... args)
+        {
+            void* payload = AllocatePayload(sizeof(T), alignof(T));
+            new (payload) T(std::forward<Args>(args)...);
+            m_Commands.push_back({ CommandType::Add, GetComponentTypeID<T>(), entity.GetID(), payload, &GetCommandOps<T>() });
+        }
+
+        template<typename T>
+        void RemoveComponent(Entity entity)
+        {
+            m_Commands.push_back({ CommandType::Remove, GetComponentTypeID<T>(), entity.GetID(), nullptr, &GetCommandOps<T>() });
+        }
+
+        // Apply and clear this buffer
+        void Playback(Registry& registry);
+
+        // Apply and clear several buffers (e.g. one per worker thread) as one merged batch
+        static void Playback(Registry& registry, std::span<EntityCommandBuffer* const> buffers);
+
+        // Discard all recorded commands
+        void Clear();
+
+        bool IsEmpty() const { return m_Commands.empty(); }
+        size_t GetCommandCount() const { return m_Commands.size(); }
+
+    private:
+        enum class CommandType : uint8_t
+        {
+            Create,
+            Add,
+            Remove,
+            Destroy
+        };
+
+        // Type-erased operations for the component type of a command
+        struct CommandOps
+        {
+            void (*reserve)(Registry& registry, size_t count);
+            void (*add)(Registry& registry, Entity entity, void* payload);
+            void (*remove)(Registry& registry, Entity entity);
+            void (*destroy)(void* payload);
+        };
+
+        struct Command
+        {
+            CommandType type;
+            ComponentTypeID typeID;
+            EntityID entity;          // Live entity or placeholder from this buffer
+            void* payload;            // Constructed component for Add
+            const CommandOps* ops;    // Add and Remove only
+        };
+
+        template<typename T>
+        static const CommandOps& GetCommandOps()
+        {
+            static const CommandOps s_Ops{
+                [](Registry& registry, size_t count) { registry.ReserveComponents<T>(count); },
+                [](Registry& registry, Entity entity, void* payload)
+                {
+                    T& component = *static_cast<T*>(payload);
+                    if constexpr (!std::is_empty_v<T>)
+                    {
+                        if (registry.HasComponent<T>(entity))
+                        {
+                            registry.Replace<T>(entity, std::move(component));
+                            return;
+                        }
+                    }
+                    registry.AddComponent<T>(entity, std::move(component));
+                },
+                [](Registry& registry, Entity entity) { registry.RemoveComponent<T>(entity); },
+                [](void* payload) { static_cast<T*>(payload)->~T(); }
+            };
+            return s_Ops;
+        }
+
+        void* AllocatePayload(size_t size, size_t alignment);
+
+        std::vector<Command> m_Commands;                    // Commands in recorded order
+        std::vector<std::unique_ptr<std::byte[]>> m_Blocks;  // Payload storage; blocks never move
+        size_t m_BlockOffset = 0;
+        size_t m_BlockSize = 0;
+        EntityID m_PlaceholderCount = 0;
+        std::vector<Entity> m_ReservedEntities;             // Reserved IDs not handed out yet; handed out from the back
+        Registry* m_ReservedRegistry = nullptr;
+    };
+}
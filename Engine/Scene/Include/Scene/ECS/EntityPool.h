@@ -0,0 +1,254 @@
+#pragma once
+#include "Types.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+#include <stdexcept>
+
+namespace Nexus
+{
+    // Allocates generational entity IDs.
+    // m_Handles holds the current handle for every index ever issued, so checking whether an
+    // ID is alive is a single compare. Destroyed slots keep their next version with the index
+    // bits set to ENTITY_INDEX_MASK, which no live ID can match.
+    //
+    // Reserve hands out IDs from any thread without modifying the arrays: an atomic cursor
+    // counts down through the free list and then below zero into indices past the end. Reserved
+    // IDs are not alive until Flush, which every other modifying call does first. Reserve must
+    // not run concurrently with those calls.
+    class EntityPool
+    {
+    public:
+        explicit EntityPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : m_Handles(resource), m_FreeIndices(resource)
+        {
+            // Index 0 is reserved for NULL_ENTITY
+            m_Handles.push_back(MakeEntityID(ENTITY_INDEX_MASK, 0));
+        }
+
+        // A pmr vector's copy constructor falls back to the default resource, so a copy takes
+        // other's resource explicitly: history frames and snapshots of a registry's pool stay in
+        // the memory the registry was given. Assignment keeps this pool's own resource.
+        EntityPool(const EntityPool& other)
+            : EntityPool(other, other.GetMemoryResource())
+        {
+        }
+
+        EntityPool(const EntityPool& other, std::pmr::memory_resource* resource)
+            : m_Handles(other.m_Handles, resource), m_FreeIndices(other.m_FreeIndices, resource),
+              m_FreeCursor(other.m_FreeCursor.load(std::memory_order_relaxed))
+        {
+        }
+
+        EntityPool& operator=(const EntityPool& other)
+        {
+            m_Handles = other.m_Handles;
+            m_FreeIndices = other.m_FreeIndices;
+            m_FreeCursor.store(other.m_FreeCursor.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        EntityID Create()
+        {
+            Flush();
+
+            // Reuse destroyed indices with their bumped version
+            if (!m_FreeIndices.empty())
+            {
+                EntityID index = m_FreeIndices.back();
+                m_FreeIndices.pop_back();
+                SyncFreeCursor();
+
+                EntityID id = MakeEntityID(index, GetEntityVersion(m_Handles[index]));
+                m_Handles[index] = id;
+                return id;
+            }
+
+            EntityID index = static_cast<EntityID>(m_Handles.size());
+            if (index > MAX_ENTITIES)
+                throw std::runtime_error("Entity limit reached");
+
+            EntityID id = MakeEntityID(index, 0);
+            m_Handles.push_back(id);
+            return id;
+        }
+
+        // Create count IDs, passing each to emit(EntityID). Free indices are reused first, then
+        // the remaining IDs are appended in one step.
+        template<typename Func>
+        void Create(size_t count, Func&& emit)
+        {
+            Flush();
+            size_t reused = std::min(count, m_FreeIndices.size());
+            size_t appended = count - reused;
+            if (m_Handles.size() - 1 + appended > MAX_ENTITIES)
+                throw std::runtime_error("Entity limit reached");
+
+            for (size_t i = 0; i < reused; i++)
+            {
+                EntityID index = m_FreeIndices.back();
+                m_FreeIndices.pop_back();
+
+                EntityID id = MakeEntityID(index, GetEntityVersion(m_Handles[index]));
+                m_Handles[index] = id;
+                emit(id);
+            }
+            SyncFreeCursor();
+
+            EntityID firstIndex = static_cast<EntityID>(m_Handles.size());
+            m_Handles.resize(m_Handles.size() + appended);
+            for (size_t i = 0; i < appended; i++)
+            {
+                EntityID id = MakeEntityID(firstIndex + static_cast<EntityID>(i), 0);
+                m_Handles[firstIndex + i] = id;
+                emit(id);
+            }
+        }
+
+        // Release a live ID; its index is recycled with the next version
+        void Destroy(EntityID id)
+        {
+            Flush();
+            EntityID index = GetEntityIndex(id);
+            EntityID nextVersion = (GetEntityVersion(id) + 1) % PLACEHOLDER_ENTITY_VERSION;
+
+            m_Handles[index] = MakeEntityID(ENTITY_INDEX_MASK, nextVersion);
+            m_FreeIndices.push_back(index);
+            SyncFreeCursor();
+        }
+
+        // Give back reserved IDs that were never handed out (main thread). Unlike Destroy the
+        // version is kept: no handle to the ID exists, so reusing it cannot alias anything.
+        void Release(std::span<const EntityID> ids)
+        {
+            Flush();
+            for (EntityID id : ids)
+            {
+                EntityID index = GetEntityIndex(id);
+                m_Handles[index] = MakeEntityID(ENTITY_INDEX_MASK, GetEntityVersion(id));
+                m_FreeIndices.push_back(index);
+            }
+            SyncFreeCursor();
+        }
+
+        // Reserve count IDs with one compare-exchange (retried under contention), passing each
+        // to emit(EntityID). Thread safe; free indices are used first, like Create.
+        template<typename Func>
+        void Reserve(size_t count, Func&& emit)
+        {
+            // The cursor is only moved if the whole range fits, so a failed reservation never
+            // publishes a position that another thread could reserve from
+            int64_t last = m_FreeCursor.load(std::memory_order_relaxed);
+            int64_t first;
+            do
+            {
+                first = last - static_cast<int64_t>(count);
+
+                // Cursor positions below zero map to new indices past the end
+                if (first < 0 && m_Handles.size() - 1 + static_cast<size_t>(-first) > MAX_ENTITIES)
+                    throw std::runtime_error("Entity limit reached");
+            } while (!m_FreeCursor.compare_exchange_weak(last, first, std::memory_order_relaxed));
+
+            for (int64_t position = last - 1; position >= first; position--)
+            {
+                if (position >= 0)
+                {
+                    EntityID index = m_FreeIndices[static_cast<size_t>(position)];
+                    emit(MakeEntityID(index, GetEntityVersion(m_Handles[index])));
+                }
+                else
+                {
+                    emit(MakeEntityID(static_cast<EntityID>(m_Handles.size() + static_cast<size_t>(-position - 1)), 0));
+                }
+            }
+        }
+
+        // Make every reserved ID alive; returns false if nothing was reserved
+        bool Flush()
+        {
+            int64_t cursor = m_FreeCursor.load(std::memory_order_relaxed);
+            if (cursor == static_cast<int64_t>(m_FreeIndices.size()))
+                return false;
+
+            // Free indices from the cursor up were handed out
+            size_t reusedFrom = static_cast<size_t>(std::max<int64_t>(cursor, 0));
+            for (size_t i = reusedFrom; i < m_FreeIndices.size(); i++)
+            {
+                EntityID index = m_FreeIndices[i];
+                m_Handles[index] = MakeEntityID(index, GetEntityVersion(m_Handles[index]));
+            }
+            m_FreeIndices.resize(reusedFrom);
+
+            if (cursor < 0)
+            {
+                size_t firstIndex = m_Handles.size();
+                m_Handles.resize(firstIndex + static_cast<size_t>(-cursor));
+                for (size_t index = firstIndex; index < m_Handles.size(); index++)
+                {
+                    m_Handles[index] = MakeEntityID(static_cast<EntityID>(index), 0);
+                }
+            }
+
+            SyncFreeCursor();
+            return true;
+        }
+
+        bool IsAlive(EntityID id) const
+        {
+            EntityID index = GetEntityIndex(id);
+            return index < m_Handles.size() && m_Handles[index] == id;
+        }
+
+        // Number of indices ever issued, including index 0 (size for per-index side tables)
+        size_t GetIndexCount() const { return m_Handles.size(); }
+        size_t GetAliveCount() const { return m_Handles.size() - 1 - m_FreeIndices.size(); }
+        size_t GetFreeCount() const { return m_FreeIndices.size(); }
+        size_t GetMemoryBytes() const { return (m_Handles.capacity() + m_FreeIndices.capacity()) * sizeof(EntityID); }
+        std::pmr::memory_resource* GetMemoryResource() const { return m_Handles.get_allocator().resource(); }
+
+        // Raw pool state, saved and restored by snapshots so entity IDs survive a round trip
+        const std::pmr::vector<EntityID>& GetHandles() const { return m_Handles; }
+        const std::pmr::vector<EntityID>& GetFreeIndices() const { return m_FreeIndices; }
+
+        void Restore(std::span<const EntityID> handles, std::span<const EntityID> freeIndices)
+        {
+            if (handles.empty() || handles.size() - 1 > MAX_ENTITIES)
+                throw std::runtime_error("Invalid entity pool state");
+
+            // Live handles sit at their own index; every dead slot is in the free list exactly once
+            size_t deadCount = 0;
+            for (size_t index = 1; index < handles.size(); index++)
+            {
+                EntityID handleIndex = GetEntityIndex(handles[index]);
+                if (handleIndex == ENTITY_INDEX_MASK)
+                    deadCount++;
+                else if (handleIndex != index || IsPlaceholderEntity(handles[index]))
+                    throw std::runtime_error("Invalid entity pool state");
+            }
+
+            std::vector<bool> listed(handles.size(), false);
+            for (EntityID index : freeIndices)
+            {
+                if (index == 0 || index >= handles.size() || listed[index] || GetEntityIndex(handles[index]) != ENTITY_INDEX_MASK)
+                    throw std::runtime_error("Invalid entity pool state");
+                listed[index] = true;
+            }
+            if (freeIndices.size() != deadCount)
+                throw std::runtime_error("Invalid entity pool state");
+
+            m_Handles.assign(handles.begin(), handles.end());
+            m_FreeIndices.assign(freeIndices.begin(), freeIndices.end());
+            SyncFreeCursor();
+        }
+
+    private:
+        void SyncFreeCursor() { m_FreeCursor.store(static_cast<int64_t>(m_FreeIndices.size()), std::memory_order_relaxed); }
+
+        std::pmr::vector<EntityID> m_Handles;       // Current handle per entity index
+        std::pmr::vector<EntityID> m_FreeIndices;   // Destroyed indices available for reuse
+        std::atomic<int64_t> m_FreeCursor{ 0 };     // Free indices not yet reserved; negative once past the end
+    };
+}
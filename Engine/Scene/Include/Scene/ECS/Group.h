@@ -0,0 +1,136 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Component.h"
+#include <span>
+#include <tuple>
+
+namespace Nexus
+{
+    class Registry; // Forward declaration
+
+    // Owning group over 2 to 4 component types.
+    // The group takes ownership of the order of its storages: every entity that has all owned
+    // components sits at the same packed index in [0, Size()) of each storage. Iterating the
+    // group is therefore a parallel linear walk over the packed arrays, with no lookups.
+    //
+    // The packed range is maintained incrementally: the owned storages call OnAdd after adding
+    // and OnRemove before removing a component, and the group swaps the entity in or out.
+    // A storage can be owned by one group only. Create groups with Registry::Group<...>().
+    template<typename... TOwned>
+    class OwningGroup final : public OwningGroupBase
+    {
+        static_assert(sizeof...(TOwned) >= 2 && sizeof...(TOwned) <= 4, "Owning groups take 2 to 4 component types");
+        static_assert((std::is_same_v<TOwned, std::remove_cv_t<TOwned>> && ...), "Owning groups take non-const component types");
+        static_assert(!(std::is_empty_v<TOwned> || ...), "Tag components cannot be owned by a group");
+
+    public:
+        OwningGroup(Registry* registry, ComponentStorage<TOwned>*... storages)
+            : m_Registry(registry), m_Storages(storages...)
+        {
+            (storages->SetGroup(this), ...);
+            Rebuild();
+        }
+
+        ~OwningGroup() override
+        {
+            std::apply([](auto*... storage) { (storage->SetGroup(nullptr), ...); }, m_Storages);
+        }
+
+        OwningGroup(const OwningGroup&) = delete;
+        OwningGroup& operator=(const OwningGroup&) = delete;
+
+        void OnAdd(EntityID entity) override
+        {
+            if (!IsGrouped(entity) && HasAll(entity))
+                MoveToPosition(entity, m_Size++);
+        }
+
+        void OnRemove(EntityID entity) override
+        {
+            if (IsGrouped(entity))
+                MoveToPosition(entity, --m_Size);
+        }
+
+        // Pack the entities that have every owned component, e.g. after the storages were replaced
+        void Rebuild() override
+        {
+            m_Size = 0;
+            auto* lead = std::get<0>(m_Storages);
+            for (size_t i = 0; i < lead->GetComponentCount(); i++)
+            {
+                EntityID entity = lead->GetEntities()[i];
+                if (HasAll(entity))
+                    MoveToPosition(entity, m_Size++);
+            }
+        }
+
+        size_t Size() const { return m_Size; }
+        bool Empty() const { return m_Size == 0; }
+
+        bool Contains(Entity entity) const { return IsGrouped(entity.GetID()); }
+
+        // Packed components of the group, index i of every span belongs to the same entity.
+        // Writes through these spans are not change-tracked.
+        template<typename T>
+        std::span<T> GetComponents() const
+        {
+            auto* storage = std::get<ComponentStorage<T>*>(m_Storages);
+            return std::span<T>(storage->GetComponents().data(), m_Size);
+        }
+
+        std::span<const EntityID> GetEntities() const
+        {
+            return std::span<const EntityID>(std::get<0>(m_Storages)->GetEntities().data(), m_Size);
+        }
+
+        // Call func(Entity, TOwned&...) for every entity in the group; marks the components changed
+        template<typename Func>
+        void ForEach(Func&& func)
+        {
+            std::apply([this](auto*... storage) { (storage->MarkChangedRange(0, m_Size), ...); }, m_Storages);
+            ForEachImpl<TOwned...>(func);
+        }
+
+        // Call func(Entity, const TOwned&...) for every entity in the group
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            ForEachImpl<const TOwned...>(func);
+        }
+
+    private:
+        template<typename... TAccess, typename Func>
+        void ForEachImpl(Func& func) const
+        {
+            const EntityID* entities = std::get<0>(m_Storages)->GetEntities().data();
+            std::tuple<TAccess*...> components(std::get<ComponentStorage<TOwned>*>(m_Storages)->GetComponents().data()...);
+
+            for (size_t i = 0; i < m_Size; i++)
+            {
+                func(Entity(entities[i], m_Registry), std::get<TAccess*>(components)[i]...);
+            }
+        }
+
+        bool HasAll(EntityID entity) const
+        {
+            return std::apply([entity](auto*... storage) { return (storage->HasComponent(entity) && ...); }, m_Storages);
+        }
+
+        bool IsGrouped(EntityID entity) const
+        {
+            ComponentIndex index = std::get<0>(m_Storages)->GetIndex(entity);
+            return index != INVALID_COMPONENT_INDEX && index < m_Size;
+        }
+
+        // Swap the entity to the given packed index in every owned storage
+        void MoveToPosition(EntityID entity, size_t position)
+        {
+            std::apply([entity, position](auto*... storage) { (storage->SwapEntries(storage->GetIndex(entity), position), ...); }, m_Storages);
+        }
+
+        Registry* m_Registry;
+        std::tuple<ComponentStorage<TOwned>*...> m_Storages;
+        size_t m_Size = 0;      // Entities in the group, packed at the front of each storage
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include "Types.h"
+#include "Snapshot.h"
+#include "Core/MappedFile.h"
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Nexus
+{
+    // A registry snapshot file used in place through a memory mapping.
+    //
+    // Raw (trivially copyable) component columns, e.g. the Transforms and MeshRenderers of static
+    // props, are read straight from the mapped pages: opening the scene costs O(page faults)
+    // instead of O(entities), nothing is copied, and read-only mappings of the same file share
+    // their pages between processes on the host. Use columns for static data that never changes
+    // at runtime, and Load the rest into a Registry, passing the mapped column names so they
+    // are not copied as well. A skipped (or unregistered) block lives in the mapping only:
+    // systems read it through GetComponents, and Registry views do not see it.
+    //
+    // Column entity IDs match the entities Load restores. With a copy-on-write mapping columns
+    // can be modified in place; the changes stay private to this process.
+    //
+    // Columns holding interned strings (SnapshotStringHolder, e.g. MeshRenderer) are usable in
+    // place when the scene's string table matches this process's, which holds when scenes are
+    // mapped at startup before other strings are interned. Otherwise GetComponents throws and
+    // GetMutableComponents remaps the column once (copy-on-write mappings). Mapped columns are
+    // not validated; map trusted files only.
+    class MappedScene
+    {
+    public:
+        explicit MappedScene(const std::string& path, MappedFile::Access access = MappedFile::Access::ReadOnly);
+
+        MappedScene(const MappedScene&) = delete;
+        MappedScene& operator=(const MappedScene&) = delete;
+
+        // Restore the entity pool and the components registered with snapshot into registry,
+        // except the columns named in mappedColumns
+        void Load(const RegistrySnapshot& snapshot, Registry& registry, std::span<const std::string> mappedColumns = {}) const
+        {
+            snapshot.Load(registry, m_File.GetData(), mappedColumns);
+        }
+
+        bool HasColumn(const std::string& name) const { return FindColumn(name) != nullptr; }
+
+        // Entities of a column, index i owns component i
+        std::span<const EntityID> GetEntities(const std::string& name) const;
+
+        // Components of a raw column, straight from the mapping
+        template<typename T>
+        std::span<const T> GetComponents(const std::string& name) const
+        {
+            const RegistrySnapshot::BlockInfo& column = GetRawColumn<T>(name);
+            if constexpr (SnapshotStringHolder<T>)
+            {
+                if (!m_Strings.IsIdentity() && !m_Remapped[&column - m_Columns.data()])
+                    throw std::runtime_error("Strings of component column '" + name + "' differ from this process; use GetMutableComponents on a copy-on-write mapping");
+            }
+            return std::span<const T>(reinterpret_cast<const T*>(m_File.GetData().data() + column.componentsOffset), column.count);
+        }
+
+        // Writable components of a raw column (copy-on-write mappings only)
+        template<typename T>
+        std::span<T> GetMutableComponents(const std::string& name)
+        {
+            const RegistrySnapshot::BlockInfo& column = GetRawColumn<T>(name);
+            std::span<T> components(reinterpret_cast<T*>(m_File.GetMutableData().data() + column.componentsOffset), column.count);
+            if constexpr (SnapshotStringHolder<T>)
+            {
+                uint8_t& remapped = m_Remapped[&column - m_Columns.data()];
+                if (!m_Strings.IsIdentity() && !remapped)
+                {
+                    for (T& component : components)
+                    {
+                        RemapStrings(component, m_Strings);
+                    }
+                    remapped = 1;
+                }
+            }
+            return components;
+        }
+
+        const std::vector<RegistrySnapshot::BlockInfo>& GetColumns() const { return m_Columns; }
+        const SnapshotStrings& GetStrings() const { return m_Strings; }
+        const MappedFile& GetFile() const { return m_File; }
+
+    private:
+        template<typename T>
+        const RegistrySnapshot::BlockInfo& GetRawColumn(const std::string& name) const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable components are stored as raw columns");
+            static_assert(alignof(T) <= CACHE_LINE_SIZE, "Raw columns are aligned to CACHE_LINE_SIZE");
+            return GetColumn(name, sizeof(T));
+        }
+
+        const RegistrySnapshot::BlockInfo* FindColumn(const std::string& name) const;
+        const RegistrySnapshot::BlockInfo& GetColumn(const std::string& name, size_t elementSize) const;
+
+        MappedFile m_File;
+        SnapshotStrings m_Strings;
+        std::vector<RegistrySnapshot::BlockInfo> m_Columns;
+        std::vector<uint8_t> m_Remapped;    // Per column: string handles rewritten in place
+    };
+}
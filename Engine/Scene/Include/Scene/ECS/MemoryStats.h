@@ -0,0 +1,45 @@
+#pragma once
+#include "Types.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Nexus
+{
+    // Memory held by one component storage.
+    // Byte counts are the allocated capacity of the storage's own arrays; heap memory owned by
+    // the components themselves (strings, vectors) is not included.
+    struct StorageMemoryStats
+    {
+        std::string_view typeName;
+        ComponentTypeID typeID = 0;
+        size_t elementSize = 0;
+        size_t count = 0;               // Components stored
+        size_t capacity = 0;            // Components the packed arrays hold before growing
+        size_t componentBytes = 0;      // Packed components
+        size_t entityBytes = 0;         // Packed entity IDs
+        size_t tickBytes = 0;           // Added and changed ticks
+        size_t indexBytes = 0;          // Sparse page table and allocated pages
+        size_t wastedBytes = 0;         // Unused capacity of the packed arrays
+        size_t sparsePages = 0;         // Allocated sparse pages
+        double fragmentation = 0.0;     // Share of allocated sparse slots that map no component
+
+        size_t GetTotalBytes() const { return componentBytes + entityBytes + tickBytes + indexBytes; }
+    };
+
+    // Memory held by a Registry and each of its component storages
+    struct RegistryMemoryStats
+    {
+        size_t aliveEntities = 0;
+        size_t peakEntities = 0;        // Most entities alive at once (indices are only appended when none are free)
+        size_t freeListLength = 0;      // Destroyed indices waiting for reuse
+        size_t entityBytes = 0;         // Entity pool and per-entity signatures
+        std::vector<StorageMemoryStats> storages;
+
+        size_t GetTotalBytes() const;
+        size_t GetWastedBytes() const;
+
+        // Structured dump for telemetry
+        std::string ToJson() const;
+    };
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Registry.h"
+#include "Shared.h"
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Nexus
+{
+    // Template for spawning many entities with the same components. The prefab keeps one
+    // prototype per component type; Instantiate creates a batch of entities and stamps each
+    // prototype into all of them with one bulk add per type (storages are reserved once and
+    // the copies are appended contiguously), instead of an AddComponent sequence per entity.
+    //
+    // Large immutable data goes in through AddShared: instances then hold a Shared<T> that
+    // points to the prototype's T until an instance calls Edit() on it. Shared<T> is its own
+    // component type, so View<T> and HasComponent<T> do not see it; share only data whose
+    // consumers query Shared<T>.
+    //
+    //   Prefab enemy;
+    //   enemy.Add<Transform>().Add<MeshRenderer>("enemy.obj", "enemy.mat").AddShared<EnemyStats>(stats);
+    //   enemy.Instantiate(registry, count, entities);
+    class Prefab
+    {
+    public:
+        Prefab() = default;
+        Prefab(Prefab&&) = default;
+        Prefab& operator=(Prefab&&) = default;
+
+        // Set the prototype of T, replacing an earlier one
+        template<typename T, typename... Args>
+        Prefab& Add(Args&&... args)
+        {
+            ComponentEntry entry{ GetComponentTypeID<T>(), Prototype(new T(std::forward<Args>(args)...), &Delete<T>), &Stamp<T> };
+            for (ComponentEntry& existing : m_Components)
+            {
+                if (existing.typeID == entry.typeID)
+                {
+                    existing = std::move(entry);
+                    return *this;
+                }
+            }
+            m_Components.push_back(std::move(entry));
+            return *this;
+        }
+
+        // Set the prototype of Shared<T>: all instances share one T (copy-on-write)
+        template<typename T, typename... Args>
+        Prefab& AddShared(Args&&... args)
+        {
+            return Add<Shared<T>>(T(std::forward<Args>(args)...));
+        }
+
+        template<typename T>
+        bool Has() const { return Find(GetComponentTypeID<T>()) != nullptr; }
+
+        // Prototype of T, for adjusting it before instantiating
+        template<typename T>
+        T& Get()
+        {
+            const ComponentEntry* entry = Find(GetComponentTypeID<T>());
+            if (!entry)
+                throw std::runtime_error("Prefab does not have component");
+            return *static_cast<T*>(entry->prototype.get());
+        }
+
+        template<typename T>
+        void Remove()
+        {
+            ComponentTypeID typeID = GetComponentTypeID<T>();
+            std::erase_if(m_Components, [typeID](const ComponentEntry& entry) { return entry.typeID == typeID; });
+        }
+
+        size_t GetComponentCount() const { return m_Components.size(); }
+
+        // Create count instances in one batch and write them to out (which must hold count handles)
+        void Instantiate(Registry& registry, size_t count, std::span<Entity> out) const;
+        Entity Instantiate(Registry& registry) const;
+
+    private:
+        using Prototype = std::unique_ptr<void, void (*)(void*)>;
+
+        struct ComponentEntry
+        {
+            ComponentTypeID typeID;
+            Prototype prototype;
+            void (*stamp)(Registry& registry, std::span<const Entity> entities, const void* prototype);
+        };
+
+        template<typename T>
+        static void Delete(void* prototype) { delete static_cast<T*>(prototype); }
+
+        template<typename T>
+        static void Stamp(Registry& registry, std::span<const Entity> entities, const void* prototype)
+        {
+            registry.AddComponents<T>(entities, *static_cast<const T*>(prototype));
+        }
+
+        const ComponentEntry* Find(ComponentTypeID typeID) const
+        {
+            for (const ComponentEntry& entry : m_Components)
+            {
+                if (entry.typeID == typeID)
+                    return &entry;
+            }
+            return nullptr;
+        }
+
+        std::vector<ComponentEntry> m_Components;
+    };
+}
@@ -2,87 +2,276 @@
 #include "Types.h"
 #include "Entity.h"
 #include "Component.h"
-#include <unordered_map>
-#include <queue>
+#include "View.h"
+#include "Group.h"
+#include "EntityPool.h"
+#include "Components/Relationship.h"
+#include "Core/Assert.h"
+#include "Core/JobSystem.h"
+#include "Core/StringTable.h"
+#include <array>
+#include <atomic>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <stdexcept>
 #include <functional>  // Added for std::ref
 
 namespace Nexus
 {
+    class RegistrySnapshot;
+
     class Registry
     {
     public:
-        Registry() : m_NextEntityID(1) {} // Start from 1, 0 is NULL_ENTITY
+        using EntityHandle = Entity;
+
+        // Storages, the entity pool and signatures allocate from resource (e.g. a MemoryArena).
+        // The resource must outlive the registry.
+        explicit Registry(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : m_EntityPool(resource), m_EntitySignatures(resource), m_Resource(resource),
+              m_NameIndex(resource), m_NameSlots(resource)
+        {
+        }
+
         ~Registry() = default;
 
+        Registry(const Registry&) = delete;
+        Registry& operator=(const Registry&) = delete;
+
         // Entity management
         Entity CreateEntity()
         {
-            EntityID id;
+            AssertStructuralChangesAllowed();
+            EntityID id = m_EntityPool.Create();
 
-            // Reuse destroyed entity IDs
-            if (!m_FreeEntityIDs.empty())
+            // Grow the per-index signature table for new indices
+            if (m_EntitySignatures.size() < m_EntityPool.GetIndexCount())
             {
-                id = m_FreeEntityIDs.front();
-                m_FreeEntityIDs.pop();
+                m_EntitySignatures.resize(m_EntityPool.GetIndexCount());
             }
-            else
+
+            return Entity(id, this);
+        }
+
+        // Reserve entity IDs from any thread, e.g. from jobs spawning entities while the main
+        // thread or other jobs iterate. A block of IDs costs one atomic operation. Reserved
+        // entities are not alive (IsValidEntity is false) until FlushReservedEntities; record
+        // their components in a per-job EntityCommandBuffer, whose Playback flushes first.
+        // Jobs that spawn one entity at a time can reserve their batch into their (per-thread)
+        // EntityCommandBuffer with EntityCommandBuffer::ReserveEntities.
+        // Must not run concurrently with structural changes.
+        Entity ReserveEntity()
+        {
+            Entity entity;
+            ReserveEntities(1, std::span<Entity>(&entity, 1));
+            return entity;
+        }
+
+        void ReserveEntities(size_t count, std::span<Entity> out)
+        {
+            if (out.size() < count)
+                throw std::runtime_error("Output span too small for ReserveEntities");
+
+            Entity* next = out.data();
+            m_EntityPool.Reserve(count, [this, &next](EntityID id) { *next++ = Entity(id, this); });
+        }
+
+        // Make all reserved entities alive (the merge step; main thread). Creating or
+        // destroying entities flushes too.
+        void FlushReservedEntities()
+        {
+            AssertStructuralChangesAllowed();
+            if (m_EntityPool.Flush() && m_EntitySignatures.size() < m_EntityPool.GetIndexCount())
             {
-                id = m_NextEntityID++;
+                m_EntitySignatures.resize(m_EntityPool.GetIndexCount());
             }
+        }
 
-            return Entity(id, this);
+        // Return reserved entities that were never used (no components, no handle kept) to the
+        // free list without bumping their version (main thread)
+        void ReleaseReservedEntities(std::span<const Entity> entities)
+        {
+            AssertStructuralChangesAllowed();
+            std::vector<EntityID> ids;
+            ids.reserve(entities.size());
+            for (Entity entity : entities)
+            {
+                ids.push_back(entity.GetID());
+            }
+            m_EntityPool.Release(ids);
         }
 
         void DestroyEntity(Entity entity)
         {
+            AssertStructuralChangesAllowed();
+            FlushReservedEntities();
             if (!IsValidEntity(entity))
                 return;
 
             EntityID id = entity.GetID();
+            ComponentSignature& signature = m_EntitySignatures[GetEntityIndex(id)];
 
-            // Remove all components for this entity
-            for (auto& pair : m_ComponentStorages)
+            // Remove components only from the storages this entity uses
+            for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS && signature.any(); typeID++)
             {
-                pair.second->RemoveComponent(id);
+                if (signature.test(typeID))
+                {
+                    m_ComponentStorages[typeID]->RemoveComponent(id);
+                    signature.reset(typeID);
+                }
             }
 
-            // Mark entity ID as free for reuse
-            m_FreeEntityIDs.push(id);
+            // Release the ID; its index is recycled with a new generation
+            m_EntityPool.Destroy(id);
+        }
+
+        // Create count entities in one batch and write them to out (which must hold count handles)
+        void CreateEntities(size_t count, std::span<Entity> out)
+        {
+            AssertStructuralChangesAllowed();
+            if (out.size() < count)
+                throw std::runtime_error("Output span too small for CreateEntities");
+
+            Entity* next = out.data();
+            m_EntityPool.Create(count, [this, &next](EntityID id) { *next++ = Entity(id, this); });
+
+            if (m_EntitySignatures.size() < m_EntityPool.GetIndexCount())
+            {
+                m_EntitySignatures.resize(m_EntityPool.GetIndexCount());
+            }
+        }
+
+        // Destroy a batch of entities; each storage involved is visited once for the whole batch
+        void DestroyEntities(std::span<const Entity> entities)
+        {
+            AssertStructuralChangesAllowed();
+            FlushReservedEntities();
+
+            std::vector<EntityID> destroyed;
+            destroyed.reserve(entities.size());
+            ComponentSignature usedTypes;
+
+            for (const Entity& entity : entities)
+            {
+                if (!IsValidEntity(entity))
+                    continue;
+
+                EntityID id = entity.GetID();
+                ComponentSignature& signature = m_EntitySignatures[GetEntityIndex(id)];
+                usedTypes |= signature;
+                signature.reset();
+                destroyed.push_back(id);
+            }
+
+            // Entities are still alive here, so OnDestroy listeners can read their components
+            for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS && usedTypes.any(); typeID++)
+            {
+                if (usedTypes.test(typeID))
+                {
+                    m_ComponentStorages[typeID]->RemoveComponents(destroyed);
+                    usedTypes.reset(typeID);
+                }
+            }
+
+            for (EntityID id : destroyed)
+            {
+                // Checked again so duplicates in the batch are only released once
+                if (m_EntityPool.IsAlive(id))
+                    m_EntityPool.Destroy(id);
+            }
         }
 
         bool IsValidEntity(Entity entity) const
         {
-            return entity.GetID() != NULL_ENTITY && entity.GetID() < m_NextEntityID;
+            return m_EntityPool.IsAlive(entity.GetID());
         }
 
+        size_t GetEntityCount() const { return m_EntityPool.GetAliveCount(); }
+        std::pmr::memory_resource* GetMemoryResource() const { return m_Resource; }
+
+        // Lookup by Name through an index that follows Name being added, removed, patched and
+        // replaced. Writes to Name through GetComponent or views are not seen by the index.
+        // FindEntityByName returns an invalid Entity when nothing has the name, and one of the
+        // entities with it otherwise.
+        Entity FindEntityByName(StringID name);
+        Entity FindEntityByName(std::string_view name);
+        std::span<const EntityID> FindEntitiesByName(StringID name) const;
+
+        // Deep copy of the entities, components and name index, allocating from resource (this
+        // registry's by default). Trivially copyable components are copied in bulk. Groups and
+        // signal listeners are not copied; declare groups on the clone again if it needs them.
+        std::unique_ptr<Registry> Clone(std::pmr::memory_resource* resource = nullptr) const;
+
+        // Memory held by the entity pool and every component storage
+        RegistryMemoryStats GetMemoryStats() const;
+
+        // Log a summary line plus one line per storage
+        void LogMemoryStats() const;
+
         // Component management
         template<typename T>
         T& AddComponent(Entity entity)
         {
+            AssertStructuralChangesAllowed();
             if (!IsValidEntity(entity))
                 throw std::runtime_error("Invalid entity");
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-
             // Get or create component storage
-            auto storage = GetOrCreateComponentStorage<T>(typeID);
-            return storage->AddComponent(entity.GetID());
+            T& component = GetOrCreateComponentStorage<T>()->AddComponent(entity.GetID());
+            m_EntitySignatures[GetEntityIndex(entity.GetID())].set(GetComponentTypeID<T>());
+            return component;
         }
 
         template<typename T, typename... Args>
         T& AddComponent(Entity entity, Args&&... args)
         {
+            AssertStructuralChangesAllowed();
             if (!IsValidEntity(entity))
                 throw std::runtime_error("Invalid entity");
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-
             // Get or create component storage
-            auto storage = GetOrCreateComponentStorage<T>(typeID);
-            return storage->AddComponent(entity.GetID(), std::forward<Args>(args)...);
+            T& component = GetOrCreateComponentStorage<T>()->AddComponent(entity.GetID(), std::forward<Args>(args)...);
+            m_EntitySignatures[GetEntityIndex(entity.GetID())].set(GetComponentTypeID<T>());
+            return component;
+        }
+
+        // Add a copy of prototype to every entity in the batch (entities that already have T keep it).
+        // The storage is reserved once and the components are appended contiguously.
+        // Tags need no prototype: registry.AddComponents<Static>(entities)
+        template<typename T>
+        void AddComponents(std::span<const Entity> entities, const T& prototype = T())
+        {
+            AssertStructuralChangesAllowed();
+            ValidateEntities(entities);
+
+            GetOrCreateComponentStorage<T>()->AddComponents(entities, prototype);
+            SetSignatureBits(entities, GetComponentTypeID<T>());
+        }
+
+        // Add components[i] to entities[i] for a whole batch (range insert)
+        template<typename T>
+        void AddComponents(std::span<const Entity> entities, std::span<const T> components)
+        {
+            AssertStructuralChangesAllowed();
+            if (entities.size() != components.size())
+                throw std::runtime_error("Entity and component counts differ");
+            ValidateEntities(entities);
+
+            GetOrCreateComponentStorage<T>()->AddComponents(entities, components);
+            SetSignatureBits(entities, GetComponentTypeID<T>());
+        }
+
+        // Reserve room for count more components of type T
+        template<typename T>
+        void ReserveComponents(size_t count)
+        {
+            AssertStructuralChangesAllowed();
+            auto storage = GetOrCreateComponentStorage<T>();
+            storage->Reserve(storage->GetComponentCount() + count);
         }
 
         template<typename T>
@@ -91,8 +280,7 @@ namespace Nexus
             if (!IsValidEntity(entity))
                 throw std::runtime_error("Invalid entity");
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
+            auto storage = GetComponentStorage<T>();
 
             if (!storage)
                 throw std::runtime_error("Component type not registered");
@@ -106,8 +294,7 @@ namespace Nexus
             if (!IsValidEntity(entity))
                 throw std::runtime_error("Invalid entity");
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
+            auto storage = GetComponentStorage<T>();
 
             if (!storage)
                 throw std::runtime_error("Component type not registered");
@@ -121,8 +308,7 @@ namespace Nexus
             if (!IsValidEntity(entity))
                 return false;
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
+            auto storage = GetComponentStorage<T>();
 
             return storage && storage->HasComponent(entity.GetID());
         }
@@ -130,23 +316,70 @@ namespace Nexus
         template<typename T>
         void RemoveComponent(Entity entity)
         {
+            AssertStructuralChangesAllowed();
             if (!IsValidEntity(entity))
                 return;
 
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
+            auto storage = GetComponentStorage<T>();
+            if (!storage)
+                return;
+
+            storage->RemoveComponent(entity.GetID());
+            m_EntitySignatures[GetEntityIndex(entity.GetID())].reset(GetComponentTypeID<T>());
+        }
 
-            if (storage)
-                storage->RemoveComponent(entity.GetID());
+        // Modify an entity's T in place through func(T&), then notify OnUpdate listeners
+        template<typename T, typename Func>
+        T& Patch(Entity entity, Func&& func)
+        {
+            T& component = GetComponent<T>(entity);
+            func(component);
+
+            const ComponentSignal& onUpdate = GetComponentStorage<T>()->OnUpdate();
+            if (!onUpdate.IsEmpty())
+                onUpdate.Publish(*this, Entity(entity.GetID(), this));
+            return component;
+        }
+
+        // Replace an entity's T with T(args...), then notify OnUpdate listeners
+        template<typename T, typename... Args>
+        T& Replace(Entity entity, Args&&... args)
+        {
+            return Patch<T>(entity, [&](T& component) { component = T(std::forward<Args>(args)...); });
         }
 
+        // Lifecycle signals for T, e.g. registry.OnConstruct<Transform>().Connect<&Index::OnAdd>(&index).
+        // Listeners are called with (Registry&, Entity): OnConstruct after T was added,
+        // OnUpdate after Patch/Replace, OnDestroy before T is removed.
+        template<typename T>
+        ComponentSignal& OnConstruct() { return GetOrCreateComponentStorage<T>()->OnConstruct(); }
+
+        template<typename T>
+        ComponentSignal& OnUpdate() { return GetOrCreateComponentStorage<T>()->OnUpdate(); }
+
+        template<typename T>
+        ComponentSignal& OnDestroy() { return GetOrCreateComponentStorage<T>()->OnDestroy(); }
+
+        // Mark an entity's T changed without accessing it (e.g. after writing through GetComponents())
+        template<typename T>
+        void MarkChanged(Entity entity)
+        {
+            auto storage = GetComponentStorage<T>();
+            if (storage && IsValidEntity(entity))
+                storage->MarkChanged(entity.GetID());
+        }
+
+        // Change detection: components are stamped with the current tick when added or accessed
+        // mutably. AdvanceTick is thread-safe and returns the new tick.
+        Tick GetCurrentTick() const { return m_CurrentTick.load(std::memory_order_relaxed); }
+        Tick AdvanceTick() { return m_CurrentTick.fetch_add(1, std::memory_order_relaxed) + 1; }
+
         // Component iteration
         template<typename T>
         std::vector<Entity> GetEntitiesWith()
         {
             std::vector<Entity> entities;
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
+            auto storage = GetComponentStorage<T>();
 
             if (storage)
             {
@@ -155,6 +388,12 @@ namespace Nexus
 
                 for (EntityID id : entityIDs)
                 {
+                    // Tag storages keep removed entries until they compact
+                    if constexpr (std::is_empty_v<T>)
+                    {
+                        if (!storage->HasComponent(id))
+                            continue;
+                    }
                     entities.emplace_back(id, this);
                 }
             }
@@ -162,99 +401,284 @@ namespace Nexus
             return entities;
         }
 
+        // View over entities with all of TComponents and none of the excluded types, e.g.
+        // registry.View<Transform, MeshRenderer>(Exclude<Light>)
+        template<typename... TComponents, typename... TExcluded>
+        BasicView<ExcludeList<TExcluded...>, TComponents...> View(ExcludeList<TExcluded...> = {})
+        {
+            return BasicView<ExcludeList<TExcluded...>, TComponents...>(this,
+                std::make_tuple(GetComponentStorage<std::remove_const_t<TComponents>>()...),
+                std::make_tuple(GetComponentStorage<TExcluded>()...));
+        }
+
         // Simple view for single component type
         template<typename T>
-        class View
+        BasicView<ExcludeList<>, T> GetView()
         {
-        public:
-            View(ComponentStorage<T>* storage, Registry* registry)
-                : m_Storage(storage), m_Registry(registry) {
-            }
+            return View<T>();
+        }
 
-            class Iterator
-            {
-            public:
-                Iterator(size_t index, ComponentStorage<T>* storage, Registry* registry)
-                    : m_Index(index), m_Storage(storage), m_Registry(registry) {
-                }
+        // Sort T's storage in place by compare(const T&, const T&), e.g. by material to batch
+        // draw calls. Views over T then visit entities in that order. Use
+        // SortAlgorithm::Insertion to re-sort cheaply when only a few keys changed.
+        template<typename T, typename Compare>
+        void Sort(Compare compare, SortAlgorithm algorithm = SortAlgorithm::Default)
+        {
+            ComponentStorage<T>* storage = GetSortableStorage<T>();
+            if (storage)
+                storage->Sort(compare, algorithm);
+        }
 
-                std::pair<Entity, T&> operator*()
-                {
-                    EntityID entityID = m_Storage->GetEntities()[m_Index];
-                    Entity entity(entityID, m_Registry);
-                    T& component = const_cast<T&>(m_Storage->GetComponents()[m_Index]);
-                    return std::pair<Entity, T&>(entity, component);
-                }
+        // Reorder T's storage to follow By's order (entities with both come first)
+        template<typename T, typename By>
+        void Sort()
+        {
+            ComponentStorage<T>* storage = GetSortableStorage<T>();
+            ComponentStorage<By>* by = GetComponentStorage<By>();
+            if (storage && by)
+                storage->SortAs(*by);
+        }
+
+        // Scene hierarchy through the Relationship component, which both entities get if they
+        // lack it. Pass Entity() as parent to make child a root. Throws if parent is child or
+        // one of its descendants.
+        void SetParent(Entity child, Entity parent);
 
-                Iterator& operator++() { ++m_Index; return *this; }
-                bool operator!=(const Iterator& other) const { return m_Index != other.m_Index; }
+        // Parent of entity, or an invalid Entity for roots and entities outside the hierarchy
+        Entity GetParent(Entity entity);
 
-            private:
-                size_t m_Index;
-                ComponentStorage<T>* m_Storage;
-                Registry* m_Registry;
-            };
+        // Call func(Entity) for each direct child, most recently parented first
+        template<typename Func>
+        void ForEachChild(Entity entity, Func&& func)
+        {
+            if (!HasComponent<Relationship>(entity))
+                return;
 
-            Iterator begin()
+            const ComponentStorage<Relationship>& relationships = *GetComponentStorage<Relationship>();
+            EntityID child = relationships.GetComponentUnchecked(entity.GetID()).firstChild;
+            while (child != NULL_ENTITY)
             {
-                return Iterator(0, m_Storage, m_Registry);
+                // Read the link first so func may reparent the child
+                EntityID next = relationships.GetComponentUnchecked(child).nextSibling;
+                func(Entity(child, this));
+                child = next;
             }
+        }
+
+        // Order the Relationship storage parent-before-child (by depth, siblings together), so
+        // a linear walk visits every parent before its children, then make each TFollow
+        // storage (e.g. Transform) follow that order. The Relationship sort only runs when
+        // reparenting or removals may have broken the order; the followers are re-sorted on
+        // every call, which is linear when they are already in order.
+        template<typename... TFollow>
+        void SortHierarchy()
+        {
+            if (!m_HierarchySorted)
+                SortRelationships();
+            (Sort<TFollow, Relationship>(), ...);
+        }
+
+        bool IsHierarchySorted() const { return m_HierarchySorted; }
 
-            Iterator end()
+        // Owning group over 2 to 4 component types, created on first use. The group keeps its
+        // storages ordered so that entities with all of TOwned are packed at the front.
+        // Declare it once, early; each component type can be owned by one group only.
+        template<typename... TOwned>
+        OwningGroup<TOwned...>& Group()
+        {
+            const void* typeKey = GetGroupTypeKey<TOwned...>();
+            for (const GroupEntry& entry : m_Groups)
             {
-                return Iterator(m_Storage ? m_Storage->GetComponentCount() : 0, m_Storage, m_Registry);
+                if (entry.typeKey == typeKey)
+                    return static_cast<OwningGroup<TOwned...>&>(*entry.group);
             }
 
-        private:
-            ComponentStorage<T>* m_Storage;
-            Registry* m_Registry;
-        };
+            AssertStructuralChangesAllowed();
+            if (((GetOrCreateComponentStorage<TOwned>()->GetGroup() != nullptr) || ...))
+                throw std::runtime_error("Component type is already owned by another group");
 
-        template<typename T>
-        View<T> GetView()
+            auto group = std::make_unique<OwningGroup<TOwned...>>(this, GetOrCreateComponentStorage<TOwned>()...);
+            OwningGroup<TOwned...>& result = *group;
+            m_Groups.push_back({ typeKey, std::move(group) });
+            return result;
+        }
+
+        // Structural changes are forbidden while any lock is held (checked in debug builds only).
+        // ParallelForEach holds one for the duration of the parallel iteration.
+        void LockStructuralChanges()
+        {
+#ifdef NEXUS_DEBUG
+            m_StructuralLocks.fetch_add(1, std::memory_order_relaxed);
+#endif
+        }
+
+        void UnlockStructuralChanges()
         {
-            ComponentTypeID typeID = GetComponentTypeID<T>();
-            auto storage = GetComponentStorage<T>(typeID);
-            return View<T>(storage, this);
+#ifdef NEXUS_DEBUG
+            m_StructuralLocks.fetch_sub(1, std::memory_order_relaxed);
+#endif
         }
 
     private:
-        // Get existing component storage
+        friend class RegistrySnapshot;    // Reads and restores the pool and storages directly
+        friend class RegistryHistory;     // Records and applies per-frame deltas
+        friend class TransformSystem;     // Walks the hierarchy storages by packed index
+
+        // Replace the entities and components with source's; groups are packed again
+        void CopyFrom(const Registry& source);
+
+        void AssertStructuralChangesAllowed() const
+        {
+#ifdef NEXUS_DEBUG
+            NEXUS_ASSERT(m_StructuralLocks.load(std::memory_order_relaxed) == 0,
+                "Structural change while a parallel view iteration is running");
+#endif
+        }
+
+        struct GroupEntry
+        {
+            const void* typeKey;
+            std::unique_ptr<OwningGroupBase> group;
+        };
+
+        // Hooks up the Name index and the hierarchy when their storage is created (by whichever
+        // path, e.g. the first SetParent), so a registry that never uses Name or Relationship
+        // has neither the storage nor the listeners
+        void OnStorageCreated(ComponentTypeID typeID, ComponentStorageBase& storage);
+
+        // Name index maintenance, connected to the Name storage's signals
+        void OnNameConstruct(Registry& registry, Entity entity);
+        void OnNameUpdate(Registry& registry, Entity entity);
+        void OnNameDestroy(Registry& registry, Entity entity);
+        void IndexName(EntityID entity);
+        void UnindexName(EntityID entity);
+
+        // Hierarchy maintenance: removing a Relationship unlinks the entity and its children
+        void OnRelationshipDestroy(Registry& registry, Entity entity);
+        void UnlinkFromParent(Relationship& relationship);
+        void SortRelationships();
+
+        // Position of an entity in the index list of its name
+        struct NameIndexSlot
+        {
+            StringID name;
+            uint32_t position = 0;
+        };
+
+        // Unique address per group type
+        template<typename... TOwned>
+        static const void* GetGroupTypeKey()
+        {
+            static const char s_Key = 0;
+            return &s_Key;
+        }
+
+        // Storage of T for sorting; group-owned storages must keep the group's order
         template<typename T>
-        ComponentStorage<T>* GetComponentStorage(ComponentTypeID typeID) const
+        ComponentStorage<T>* GetSortableStorage()
+        {
+            static_assert(!std::is_empty_v<T>, "Tag components have no order to sort");
+            AssertStructuralChangesAllowed();
+            ComponentStorage<T>* storage = GetComponentStorage<T>();
+            if (storage && storage->GetGroup())
+                throw std::runtime_error("Cannot sort a component storage owned by a group");
+            return storage;
+        }
+
+        // Throw before a batch operation modifies anything if one of its entities is invalid
+        void ValidateEntities(std::span<const Entity> entities) const
+        {
+            for (const Entity& entity : entities)
+            {
+                if (!IsValidEntity(entity))
+                    throw std::runtime_error("Invalid entity");
+            }
+        }
+
+        void SetSignatureBits(std::span<const Entity> entities, ComponentTypeID typeID)
         {
-            auto it = m_ComponentStorages.find(typeID);
-            if (it != m_ComponentStorages.end())
+            for (const Entity& entity : entities)
             {
-                return static_cast<ComponentStorage<T>*>(it->second.get());
+                m_EntitySignatures[GetEntityIndex(entity.GetID())].set(typeID);
             }
-            return nullptr;
+        }
+
+        // Get existing component storage (one array index, no lookup)
+        template<typename T>
+        ComponentStorage<T>* GetComponentStorage() const
+        {
+            return static_cast<ComponentStorage<T>*>(m_ComponentStorages[GetComponentTypeID<T>()].get());
         }
 
         // Get or create component storage
         template<typename T>
-        ComponentStorage<T>* GetOrCreateComponentStorage(ComponentTypeID typeID)
+        ComponentStorage<T>* GetOrCreateComponentStorage()
         {
-            auto it = m_ComponentStorages.find(typeID);
-            if (it != m_ComponentStorages.end())
+            std::unique_ptr<ComponentStorageBase>& slot = m_ComponentStorages[GetComponentTypeID<T>()];
+            if (!slot)
             {
-                return static_cast<ComponentStorage<T>*>(it->second.get());
+                slot = std::make_unique<ComponentStorage<T>>(this, &m_CurrentTick, m_Resource);
+                OnStorageCreated(GetComponentTypeID<T>(), *slot);
             }
 
-            // Create new storage
-            auto storage = std::make_unique<ComponentStorage<T>>();
-            ComponentStorage<T>* rawPtr = storage.get();
-            m_ComponentStorages[typeID] = std::move(storage);
-
-            return rawPtr;
+            return static_cast<ComponentStorage<T>*>(slot.get());
         }
 
     private:
-        EntityID m_NextEntityID;
-        std::queue<EntityID> m_FreeEntityIDs;
-        std::unordered_map<ComponentTypeID, std::unique_ptr<ComponentStorageBase>> m_ComponentStorages;
+        EntityPool m_EntityPool;
+        std::pmr::vector<ComponentSignature> m_EntitySignatures; // Component types used, per entity index
+        std::array<std::unique_ptr<ComponentStorageBase>, MAX_COMPONENTS> m_ComponentStorages; // Indexed by ComponentTypeID
+        std::atomic<Tick> m_CurrentTick{ 1 };                  // Change-detection tick stamped into storages
+        std::vector<GroupEntry> m_Groups;                       // Declared after the storages so groups are destroyed first
+        std::pmr::memory_resource* m_Resource;                  // Backs the pool, signatures and storages
+        std::pmr::unordered_map<StringID, std::pmr::vector<EntityID>> m_NameIndex;   // Entities per name
+        std::pmr::vector<NameIndexSlot> m_NameSlots;            // Indexed name per entity index
+        bool m_HierarchySorted = true;                          // Relationship storage is parent-before-child
+
+#ifdef NEXUS_DEBUG
+        std::atomic<uint32_t> m_StructuralLocks{ 0 };           // Active parallel iterations
+#endif
     };
 
+    // Implementation of BasicView::ParallelForEach (here because it needs the complete Registry)
+    template<typename... TExcluded, typename... TComponents>
+    template<typename Func>
+    void BasicView<ExcludeList<TExcluded...>, TComponents...>::ParallelForEach(JobSystem& jobs, const Func& func, size_t batchSize) const
+    {
+        if (!m_Driver || m_Driver->empty())
+            return;
+
+        constexpr size_t granularity = GetCacheLineGranularity();
+        size_t count = m_Driver->size();
+
+        // Default to a few batches per thread so stealing can balance uneven callbacks
+        if (batchSize == 0)
+            batchSize = count / (size_t(jobs.GetThreadCount()) * 4);
+        batchSize = std::max(granularity, (batchSize + granularity - 1) / granularity * granularity);
+
+        struct StructuralLockScope
+        {
+            Registry* registry;
+            explicit StructuralLockScope(Registry* r) : registry(r) { registry->LockStructuralChanges(); }
+            ~StructuralLockScope() { registry->UnlockStructuralChanges(); }
+        } lock(m_Registry);
+
+        const Func* function = &func;
+        jobs.ParallelFor(count, batchSize, [this, function](size_t begin, size_t end)
+            {
+                const std::pmr::vector<EntityID>& entities = *m_Driver;
+                for (size_t i = begin; i < end; i++)
+                {
+                    EntityID entityID = entities[i];
+                    if (!IsMatch(entityID))
+                        continue;
+
+                    (*function)(Entity(entityID, m_Registry),
+                        Fetch<TComponents>(m_Storages, entityID)...);
+                }
+            });
+    }
+
     // Implementation of Entity's template methods (here to avoid circular dependency)
     template<typename T>
     T& Entity::AddComponent()
@@ -291,4 +715,6 @@ namespace Nexus
     {
         m_Registry->RemoveComponent<T>(*this);
     }
-}
\ No newline at end of file
+
+    static_assert(EntityRegistry<Registry>);
+}
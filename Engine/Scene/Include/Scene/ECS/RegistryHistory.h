@@ -0,0 +1,91 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Component.h"
+#include "EntityPool.h"
+#include "Registry.h"
+#include <array>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Nexus
+{
+    // Ring of the last N frames of a registry, for rollback. Record() stores what changed since
+    // the previous Record: the components added or written (found through the change ticks),
+    // the components removed (collected from the storages' OnDestroy), and the entity pool if
+    // entities were created or destroyed. Rewind(k) restores the registry as it was k records ago.
+    //
+    // The history keeps a clone of the registry from before its oldest frame. Once the ring is
+    // full, each Record folds the oldest frame into that clone, so recording costs one delta
+    // capture plus one delta apply. Rewinding copies the clone back in bulk and replays the
+    // frames that remain, then drops the rewound frames.
+    //
+    //   RegistryHistory history(registry, 60);
+    //   every frame: update systems, then history.Record();
+    //   on a misprediction: history.Rewind(framesBack), then resimulate
+    //
+    // Writes that do not stamp the change tick (through GetComponents() or group spans) must be
+    // followed by MarkChanged, or they are missed. Restored components count as changed.
+    // Listeners see the adds, writes and removes of replayed frames but not the bulk copy.
+    // Component types must be copyable. The history must not outlive the registry.
+    class RegistryHistory
+    {
+    public:
+        RegistryHistory(Registry& registry, size_t capacity);
+        ~RegistryHistory();
+
+        RegistryHistory(const RegistryHistory&) = delete;
+        RegistryHistory& operator=(const RegistryHistory&) = delete;
+
+        // Store the changes since the previous Record (or construction) as the newest frame
+        void Record();
+
+        // Restore the state of frames records ago; 0 discards the changes since the last Record
+        void Rewind(size_t frames = 0);
+
+        size_t GetFrameCount() const { return m_Frames.size(); }
+        size_t GetCapacity() const { return m_Capacity; }
+
+        // Clone plus recorded deltas
+        size_t GetMemoryBytes() const;
+
+    private:
+        struct TypeDelta
+        {
+            ComponentTypeID typeID;
+            std::unique_ptr<ComponentDeltaBase> delta;
+        };
+
+        struct Frame
+        {
+            std::optional<EntityPool> pool;     // Only when entities were created or destroyed
+            std::vector<TypeDelta> deltas;
+        };
+
+        // Entities given or stripped of one component type since the last Record
+        struct ComponentTrack
+        {
+            std::vector<EntityID> added;
+            std::vector<EntityID> removed;
+
+            void OnConstruct(Registry&, Entity entity) { added.push_back(entity.GetID()); }
+            void OnDestroy(Registry&, Entity entity) { removed.push_back(entity.GetID()); }
+        };
+
+        // Track of a storage, connecting to it on first use; true if it was just connected
+        bool AssureTrack(ComponentTypeID typeID);
+        void ClearTracks();
+
+        static void ApplyFrame(Registry& target, const Frame& frame);
+
+        Registry& m_Registry;
+        size_t m_Capacity;
+        std::unique_ptr<Registry> m_Base;       // State before the oldest frame
+        std::deque<Frame> m_Frames;             // Oldest first
+        EntityPool m_LastPool;                  // Pool at the last Record, to detect changes
+        Tick m_LastTick = 0;                    // Changes stamped after this tick are unrecorded
+        std::array<std::unique_ptr<ComponentTrack>, MAX_COMPONENTS> m_Tracks;   // Indexed by ComponentTypeID
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+#include <utility>
+
+namespace Nexus
+{
+    // Component wrapper for large, read-mostly data shared between entities, e.g. the stats
+    // of every instance of a prefab. Copies point to the same immutable T, so a thousand
+    // instances hold a thousand pointers and one T. Edit() is copy-on-write: it gives this
+    // entity its own T first if any other entity still shares it. Shared<T> is a component
+    // type of its own; queries for T do not match it.
+    //
+    // Copies of one Shared may be read from any thread. Edit, IsShared and GetShareCount are
+    // single-threaded: they rely on shared_ptr::use_count, which is only exact while no other
+    // thread copies or destroys a Shared of the same data (run them from an Exclusive system
+    // or outside the scheduler).
+    template<typename T>
+    class Shared
+    {
+    public:
+        Shared() : m_Data(std::make_shared<T>()) {}
+        explicit Shared(T value) : m_Data(std::make_shared<T>(std::move(value))) {}
+
+        const T& Get() const { return *m_Data; }
+        const T& operator*() const { return *m_Data; }
+        const T* operator->() const { return m_Data.get(); }
+
+        // Writable T owned by this entity alone
+        T& Edit()
+        {
+            if (m_Data.use_count() > 1)
+                m_Data = std::make_shared<T>(*m_Data);
+            return *m_Data;
+        }
+
+        bool IsShared() const { return m_Data.use_count() > 1; }
+        long GetShareCount() const { return m_Data.use_count(); }
+
+    private:
+        std::shared_ptr<T> m_Data;
+    };
+}
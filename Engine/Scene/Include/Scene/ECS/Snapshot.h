@@ -0,0 +1,447 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Registry.h"
+#include "Core/StringTable.h"
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Nexus
+{
+    class MeshRenderer;
+    class Name;
+    class Tag;
+
+    // Appends snapshot data to a byte buffer (native byte order)
+    class SnapshotWriter
+    {
+    public:
+        explicit SnapshotWriter(std::vector<uint8_t>& buffer) : m_Buffer(buffer) {}
+
+        void WriteBytes(const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+        }
+
+        template<typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Write takes trivially copyable values");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        void WriteString(const std::string& value)
+        {
+            Write(static_cast<uint32_t>(value.size()));
+            WriteBytes(value.data(), value.size());
+        }
+
+        void WriteEntity(Entity entity) { Write(entity.GetID()); }
+
+        size_t GetSize() const { return m_Buffer.size(); }
+
+        // Pad with zeros up to a multiple of alignment from the start of the snapshot
+        void Align(size_t alignment)
+        {
+            size_t padding = (alignment - m_Buffer.size() % alignment) % alignment;
+            m_Buffer.insert(m_Buffer.end(), padding, uint8_t(0));
+        }
+
+        // Reserve a size field for a block; EndBlock patches it with the bytes written since
+        size_t BeginBlock()
+        {
+            Write(uint64_t(0));
+            return m_Buffer.size();
+        }
+
+        void EndBlock(size_t blockStart)
+        {
+            uint64_t size = m_Buffer.size() - blockStart;
+            std::memcpy(m_Buffer.data() + blockStart - sizeof(uint64_t), &size, sizeof(uint64_t));
+        }
+
+    private:
+        std::vector<uint8_t>& m_Buffer;
+    };
+
+    // Reads snapshot data; every read is bounds checked and throws on truncated input
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(std::span<const uint8_t> data, Registry* registry)
+            : m_Data(data), m_Registry(registry)
+        {
+        }
+
+        void ReadBytes(void* out, size_t size)
+        {
+            Require(size);
+            if (size != 0)
+                std::memcpy(out, m_Data.data() + m_Offset, size);
+            m_Offset += size;
+        }
+
+        template<typename T>
+        T Read()
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Read takes trivially copyable values");
+            T value;
+            ReadBytes(&value, sizeof(T));
+            return value;
+        }
+
+        std::string ReadString()
+        {
+            uint32_t size = Read<uint32_t>();
+            Require(size);
+            std::string value(reinterpret_cast<const char*>(m_Data.data() + m_Offset), size);
+            m_Offset += size;
+            return value;
+        }
+
+        // Entity bound to the registry being loaded
+        Entity ReadEntity() { return Entity(Read<EntityID>(), m_Registry); }
+
+        void Skip(size_t size)
+        {
+            Require(size);
+            m_Offset += size;
+        }
+
+        // Skip the padding written by SnapshotWriter::Align
+        void Align(size_t alignment)
+        {
+            Skip((alignment - m_Offset % alignment) % alignment);
+        }
+
+        // Throw unless count elements of elementSize bytes can still be read
+        void RequireElements(size_t count, size_t elementSize) const
+        {
+            if (elementSize != 0 && count > GetRemaining() / elementSize)
+                throw std::runtime_error("Snapshot is truncated");
+        }
+
+        size_t GetOffset() const { return m_Offset; }
+        size_t GetRemaining() const { return m_Data.size() - m_Offset; }
+        Registry* GetRegistry() const { return m_Registry; }
+
+    private:
+        void Require(size_t size) const
+        {
+            if (size > GetRemaining())
+                throw std::runtime_error("Snapshot is truncated");
+        }
+
+        std::span<const uint8_t> m_Data;
+        size_t m_Offset = 0;
+        Registry* m_Registry;
+    };
+
+    // Interned strings of a snapshot. Raw components store indices into the snapshot's own
+    // string table, which holds only the strings they reference; loading interns that table
+    // into this process. Saving numbers the referenced strings in order of first use.
+    class SnapshotStrings
+    {
+    public:
+        // Loading: this process's handle for a handle saved in the snapshot.
+        // Saving: the snapshot's handle for a handle of this process.
+        StringID Remap(StringID saved) const
+        {
+            if (m_Saving)
+                return AssignSaved(saved);
+            if (saved.GetIndex() >= m_IDs.size())
+                throw std::runtime_error("Snapshot references a string outside its string table");
+            return m_IDs[saved.GetIndex()];
+        }
+
+        // Saved handles are valid in this process as they are (same strings at the same indices)
+        bool IsIdentity() const { return m_Identity; }
+
+    private:
+        friend class RegistrySnapshot;
+
+        StringID AssignSaved(StringID id) const
+        {
+            uint32_t index = id.GetIndex();
+            if (index >= m_SavedIndices.size())
+                m_SavedIndices.resize(index + 1, 0);
+
+            uint32_t& saved = m_SavedIndices[index];
+            if (saved == 0 && index != 0)
+            {
+                saved = static_cast<uint32_t>(m_IDs.size());
+                m_IDs.push_back(id);
+            }
+            return StringTable::Get().GetID(saved);
+        }
+
+        // Loading: this process's handle per snapshot index. Saving: the referenced handles in
+        // snapshot order (filled by Remap, hence mutable).
+        mutable std::vector<StringID> m_IDs;
+        mutable std::vector<uint32_t> m_SavedIndices;   // Saving: snapshot index per process index (0 = none yet)
+        bool m_Identity = true;
+        bool m_Saving = false;
+    };
+
+    // Raw components that hold interned strings map them to this process's handles on load.
+    // Other such components provide an overload with the same signature in their own namespace.
+    void RemapStrings(MeshRenderer& meshRenderer, const SnapshotStrings& strings);
+
+    template<typename T>
+    concept SnapshotStringHolder = requires(T& component, const SnapshotStrings& strings)
+    {
+        RemapStrings(component, strings);
+    };
+
+    // Serializers for the built-in components that are not trivially copyable or whose strings
+    // are stored per component. Other such components provide overloads with the same
+    // signatures in their own namespace.
+    void Serialize(SnapshotWriter& writer, const Name& name);
+    void Deserialize(SnapshotReader& reader, Name& name);
+    void Serialize(SnapshotWriter& writer, const Tag& tag);
+    void Deserialize(SnapshotReader& reader, Tag& tag);
+
+    // Components with Serialize/Deserialize overloads go through them even when they are
+    // trivially copyable
+    template<typename T>
+    concept SnapshotSerializable = requires(SnapshotWriter& writer, SnapshotReader& reader, const T& in, T& out)
+    {
+        Serialize(writer, in);
+        Deserialize(reader, out);
+    };
+
+    // Versioned binary snapshot of a Registry's entities and components.
+    //
+    // Layout: header (magic, version), the entity pool (so entity IDs survive a round trip), the
+    // strings raw components reference, then one block per registered component type: stable
+    // name, encoding, element size, entity IDs and the packed components. Entity IDs and raw
+    // component arrays start on a cache line boundary, so a mapped snapshot can be used in
+    // place (see MappedScene). Raw components store their StringIDs (e.g. MeshRenderer paths)
+    // as indices into the snapshot's string table; loading remaps them to this process.
+    // Trivially copyable components are copied as one block, tag (empty) components store
+    // only their entity IDs, and types with Serialize/Deserialize overloads go through them. Types are matched by their registered
+    // name because ComponentTypeIDs depend on the order of first use. Unknown blocks are skipped.
+    //
+    // Saving reads the packed arrays straight out of the storages; pass the same buffer every
+    // time and quick-saves do not allocate once it has grown. Loading fills each storage in
+    // bulk, without per-entity lookups. Snapshots are not portable across byte orders.
+    class RegistrySnapshot
+    {
+    public:
+        static constexpr uint32_t MAGIC = 0x4E53584E;   // "NXSN"
+        static constexpr uint32_t VERSION = 3;
+
+        // Location of one component block inside a snapshot
+        struct BlockInfo
+        {
+            std::string name;
+            bool raw;                   // Components stored as packed bytes
+            uint32_t elementSize;
+            size_t count;
+            size_t entitiesOffset;      // From the start of the snapshot, CACHE_LINE_SIZE aligned
+            size_t componentsOffset;    // Raw blocks only, CACHE_LINE_SIZE aligned
+        };
+
+        // Index of the component blocks of a snapshot, without loading any component; the
+        // snapshot's string table is interned into strings
+        static std::vector<BlockInfo> ReadBlocks(std::span<const uint8_t> data, SnapshotStrings& strings);
+
+        // Registers the built-in components
+        RegistrySnapshot();
+
+        // Include T in snapshots under a name that must stay the same across builds
+        template<typename T>
+        void RegisterComponent(const std::string& name)
+        {
+            ComponentEntry entry;
+            entry.name = name;
+            entry.typeID = GetComponentTypeID<T>();
+            entry.encoding = GetEncoding<T>();
+            entry.elementSize = std::is_empty_v<T> ? 0 : sizeof(T);
+            entry.save = &SaveStorage<T>;
+            entry.load = &LoadStorage<T>;
+            entry.collectStrings = nullptr;
+            if constexpr (GetEncoding<T>() == Encoding::Raw && SnapshotStringHolder<T>)
+                entry.collectStrings = &CollectStrings<T>;
+            AddEntry(std::move(entry));
+        }
+
+        // Write the registry into out (cleared first, its capacity is reused)
+        void Save(const Registry& registry, std::vector<uint8_t>& out) const;
+        std::vector<uint8_t> Save(const Registry& registry) const;
+
+        // Restore a snapshot into a registry that has no entities; its entity pool is replaced.
+        // OnConstruct listeners and owning groups see the restored components.
+        // Throws on malformed data, leaving the registry partially loaded; discard it then.
+        // Blocks named in skip are left out, e.g. columns a MappedScene serves in place.
+        void Load(Registry& registry, std::span<const uint8_t> data, std::span<const std::string> skip = {}) const;
+
+        void SaveToFile(const Registry& registry, const std::string& path) const;
+        void LoadFromFile(Registry& registry, const std::string& path) const;
+
+    private:
+        enum class Encoding : uint32_t
+        {
+            Raw = 0,            // Packed components copied as bytes
+            Serialized = 1,     // Serialize/Deserialize per component
+            Tag = 2             // Empty components: entity IDs only
+        };
+
+        struct ComponentEntry
+        {
+            std::string name;
+            ComponentTypeID typeID;
+            Encoding encoding;
+            uint32_t elementSize;
+            void (*save)(const ComponentStorageBase& storage, SnapshotWriter& writer, const SnapshotStrings& strings);
+            void (*load)(Registry& registry, SnapshotReader& reader, size_t count, const SnapshotStrings& strings);
+            void (*collectStrings)(const ComponentStorageBase& storage, const SnapshotStrings& strings);   // Raw string holders only
+        };
+
+        static void ReadHeader(SnapshotReader& reader);
+        static void WriteStrings(SnapshotWriter& writer, const SnapshotStrings& strings);
+        static SnapshotStrings ReadStrings(SnapshotReader& reader);
+        static void ValidateHierarchy(const Registry& registry);
+
+        template<typename T>
+        static constexpr Encoding GetEncoding()
+        {
+            if constexpr (std::is_empty_v<T>)
+                return Encoding::Tag;
+            else if constexpr (SnapshotSerializable<T>)
+                return Encoding::Serialized;
+            else
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "Component needs Serialize/Deserialize overloads to be saved");
+                return Encoding::Raw;
+            }
+        }
+
+        void AddEntry(ComponentEntry entry);
+        const ComponentEntry* FindEntry(const std::string& name) const;
+
+        // Number the strings of a raw string-holding storage before the string table is written
+        template<typename T>
+        static void CollectStrings(const ComponentStorageBase& base, const SnapshotStrings& strings)
+        {
+            for (T component : static_cast<const ComponentStorage<T>&>(base).GetComponents())
+            {
+                RemapStrings(component, strings);
+            }
+        }
+
+        template<typename T>
+        static void SaveStorage(const ComponentStorageBase& base, SnapshotWriter& writer, const SnapshotStrings& strings)
+        {
+            const auto& storage = static_cast<const ComponentStorage<T>&>(base);
+            const std::pmr::vector<EntityID>& entities = storage.GetEntities();
+
+            writer.Align(CACHE_LINE_SIZE);
+            if constexpr (GetEncoding<T>() == Encoding::Tag)
+            {
+                // The tag list may hold removed entries; the block lists members only
+                for (EntityID entity : entities)
+                {
+                    if (storage.HasComponent(entity))
+                        writer.Write(entity);
+                }
+            }
+            else if constexpr (GetEncoding<T>() == Encoding::Raw)
+            {
+                const std::pmr::vector<T>& components = storage.GetComponents();
+                writer.WriteBytes(entities.data(), entities.size() * sizeof(EntityID));
+                writer.Align(CACHE_LINE_SIZE);
+                if constexpr (SnapshotStringHolder<T>)
+                {
+                    // Handles are rewritten to the snapshot's string table
+                    for (T component : components)
+                    {
+                        RemapStrings(component, strings);
+                        writer.Write(component);
+                    }
+                }
+                else
+                {
+                    writer.WriteBytes(components.data(), components.size() * sizeof(T));
+                }
+            }
+            else
+            {
+                writer.WriteBytes(entities.data(), entities.size() * sizeof(EntityID));
+                for (const T& component : storage.GetComponents())
+                {
+                    Serialize(writer, component);
+                }
+            }
+        }
+
+        template<typename T>
+        static void LoadStorage(Registry& registry, SnapshotReader& reader, size_t count, const SnapshotStrings& strings)
+        {
+            // Build the arrays in the storage's memory resource so Assign can adopt them
+            ComponentStorage<T>* storage = registry.GetOrCreateComponentStorage<T>();
+            std::pmr::memory_resource* resource = storage->GetMemoryResource();
+
+            reader.Align(CACHE_LINE_SIZE);
+            reader.RequireElements(count, sizeof(EntityID));
+            std::pmr::vector<EntityID> entities(count, resource);
+            reader.ReadBytes(entities.data(), count * sizeof(EntityID));
+
+            // Every ID must be alive in the restored pool and appear once
+            ComponentTypeID typeID = GetComponentTypeID<T>();
+            for (EntityID entity : entities)
+            {
+                if (!registry.m_EntityPool.IsAlive(entity))
+                    throw std::runtime_error("Snapshot references an entity that is not alive");
+
+                ComponentSignature& signature = registry.m_EntitySignatures[GetEntityIndex(entity)];
+                if (signature.test(typeID))
+                    throw std::runtime_error("Snapshot lists an entity twice in one component block");
+                signature.set(typeID);
+            }
+
+            if constexpr (GetEncoding<T>() == Encoding::Tag)
+            {
+                storage->Assign(std::move(entities));
+            }
+            else
+            {
+                std::pmr::vector<T> components(resource);
+                if constexpr (GetEncoding<T>() == Encoding::Raw)
+                {
+                    reader.Align(CACHE_LINE_SIZE);
+                    reader.RequireElements(count, sizeof(T));
+                    components.resize(count);
+                    reader.ReadBytes(components.data(), count * sizeof(T));
+
+                    // Always remapped: this also rejects handles outside the string table
+                    if constexpr (SnapshotStringHolder<T>)
+                    {
+                        for (T& component : components)
+                        {
+                            RemapStrings(component, strings);
+                        }
+                    }
+                }
+                else
+                {
+                    components.resize(count);
+                    for (T& component : components)
+                    {
+                        Deserialize(reader, component);
+                    }
+                }
+
+                storage->Assign(std::move(entities), std::move(components));
+            }
+        }
+
+        std::vector<ComponentEntry> m_Entries;
+    };
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "Types.h"
+#include "Core/JobSystem.h"
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Nexus
+{
+    class Registry;
+
+    // Component access a system declares when it is registered
+    struct ComponentAccess
+    {
+        ComponentSignature reads;
+        ComponentSignature writes;
+        bool exclusive = false;       // Conflicts with every other system (e.g. structural changes)
+
+        bool ConflictsWith(const ComponentAccess& other) const
+        {
+            return exclusive || other.exclusive ||
+                (writes & (other.reads | other.writes)).any() ||
+                (reads & other.writes).any();
+        }
+    };
+
+    // Access declarations, e.g. scheduler.AddSystem<Reads<Transform>, Writes<Light>>(...)
+    template<typename... TComponents>
+    struct Reads
+    {
+        static void Apply(ComponentAccess& access) { (access.reads.set(GetComponentTypeID<TComponents>()), ...); }
+    };
+
+    template<typename... TComponents>
+    struct Writes
+    {
+        static void Apply(ComponentAccess& access) { (access.writes.set(GetComponentTypeID<TComponents>()), ...); }
+    };
+
+    // The system needs the whole registry to itself (entity creation, adding/removing components)
+    struct Exclusive
+    {
+        static void Apply(ComponentAccess& access) { access.exclusive = true; }
+    };
+
+    // Passed to every system when it runs
+    struct SystemContext
+    {
+        Registry& registry;
+        JobSystem& jobs;
+        Tick lastRunTick;             // Tick of this system's previous run (0 on the first), for Changed/Added filters
+    };
+
+    using SystemFunction = std::function<void(SystemContext&)>;
+
+    // When and where a system ran during the last frame
+    struct SystemTimelineEntry
+    {
+        uint32_t systemIndex;
+        uint32_t threadIndex;
+        double startMilliseconds;     // Relative to the start of the frame
+        double endMilliseconds;
+    };
+
+    // Runs registered systems each frame on the job system.
+    // Each system declares the components it reads and writes. At registration every earlier
+    // system whose access conflicts with the new one becomes a dependency, so conflicting
+    // systems keep their registration order and everything else runs in parallel.
+    //
+    // Every system run advances the registry tick and remembers it, so a system can use
+    // View::Changed/Added with context.lastRunTick to visit only what changed since it last ran.
+    // The filters are conservative: a change may be reported once more, but never missed.
+    class SystemScheduler
+    {
+    public:
+        SystemScheduler() = default;
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        // Register a system; returns its index
+        template<typename... TAccess>
+        uint32_t AddSystem(const std::string& name, SystemFunction function)
+        {
+            ComponentAccess access;
+            (TAccess::Apply(access), ...);
+            return AddSystem(name, access, std::move(function));
+        }
+
+        uint32_t AddSystem(const std::string& name, const ComponentAccess& access, SystemFunction function);
+
+        // Run every system once and return when all have finished; the calling thread helps.
+        // If a system throws, systems that have not started yet are skipped and the first
+        // exception is rethrown here once the running ones have finished.
+        void Run(Registry& registry, JobSystem& jobs);
+
+        // Timeline of the last Run, one entry per system in registration order
+        const std::vector<SystemTimelineEntry>& GetTimeline() const { return m_Timeline; }
+        void LogTimeline() const;
+
+        size_t GetSystemCount() const { return m_Systems.size(); }
+        const std::string& GetSystemName(uint32_t index) const { return m_Systems[index].name; }
+
+        // Systems that must finish before the given system starts
+        const std::vector<uint32_t>& GetDependencies(uint32_t index) const { return m_Systems[index].dependencies; }
+
+    private:
+        struct System
+        {
+            std::string name;
+            ComponentAccess access;
+            SystemFunction function;
+            std::vector<uint32_t> dependencies;   // Earlier conflicting systems
+            std::vector<uint32_t> dependents;     // Later conflicting systems
+            Tick lastRunTick = 0;
+        };
+
+        void Schedule(uint32_t index);
+        void Execute(uint32_t index);
+
+        std::vector<System> m_Systems;
+        std::vector<SystemTimelineEntry> m_Timeline;
+
+        // Per-frame state
+        std::unique_ptr<std::atomic<uint32_t>[]> m_PendingDependencies;
+        Registry* m_Registry = nullptr;
+        JobSystem* m_Jobs = nullptr;
+        JobCounter* m_FrameCounter = nullptr;
+        std::chrono::steady_clock::time_point m_FrameStart;
+        std::atomic<bool> m_Failed{ false };
+        std::exception_ptr m_Exception;          // First exception thrown by a system this frame
+        std::mutex m_ExceptionMutex;
+    };
+}
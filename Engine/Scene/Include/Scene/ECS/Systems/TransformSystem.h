@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/Relationship.h"
+#include "Core/JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Nexus
+{
+    // Computes world matrices: parent world * local down the Relationship hierarchy, and the
+    // local matrix for transforms outside it. Only dirty transforms (MarkDirty, which every
+    // setter calls) and their descendants are recomputed; the dirty state flows down as the
+    // hierarchy is walked one depth level at a time, parents before children. With a job
+    // system, each level is split across worker threads.
+    //
+    // Update sorts the hierarchy (Registry::SortHierarchy<Transform>), so it is a structural
+    // step: register it with the scheduler as Exclusive. Storages owned by a group (e.g. the
+    // RenderSystem's Transform/MeshRenderer group) keep the group's order and are walked
+    // through lookups instead. Recomputed transforms are stamped as
+    // changed, so Changed<Transform> filters see children that moved with their parent.
+    // A hierarchy node without a Transform breaks the chain: its children are treated as roots.
+    // Reparenting needs no MarkDirty; the system notices the new parent itself.
+    class TransformSystem
+    {
+    public:
+        void Update(Registry& registry);
+        void Update(Registry& registry, JobSystem& jobs);
+
+        // Transforms whose world matrix was recomputed by the last Update
+        size_t GetUpdatedCount() const { return m_UpdatedCount.load(std::memory_order_relaxed); }
+
+    private:
+        static constexpr uint32_t NO_INDEX = UINT32_MAX;
+
+        void Update(Registry& registry, JobSystem* jobs);
+        void BuildLevels(const ComponentStorage<Relationship>& relationships, ComponentStorage<Transform>& transforms);
+        void AssignDepths();
+        void UpdateNodes(ComponentStorage<Transform>& transforms, const uint32_t* nodes, size_t count);
+        void UpdateRoots(ComponentStorage<Transform>& transforms, const ComponentStorage<Relationship>& relationships, size_t begin, size_t end);
+
+        // Per Relationship index, rebuilt on every Update
+        std::vector<uint32_t> m_Parents;        // Relationship index of the parent, NO_INDEX for roots
+        std::vector<uint32_t> m_Transforms;     // Transform index, NO_INDEX without one
+        std::vector<uint32_t> m_Depths;
+        std::vector<uint8_t> m_Updated;         // World matrix recomputed this Update
+
+        std::vector<uint32_t> m_Nodes;          // Relationship indices grouped by depth
+        std::vector<size_t> m_LevelStarts;      // Start of each depth level in m_Nodes, plus the end
+        size_t m_HierarchyTransforms = 0;       // Transforms in the hierarchy
+        bool m_HierarchyFirst = false;          // Those transforms lead their storage, in hierarchy order
+
+        // Per entity index: the parent the world matrix was last computed from, NULL_ENTITY
+        // for none (a root, or a parent without a Transform)
+        std::vector<EntityID> m_WorldParents;
+        std::atomic<size_t> m_UpdatedCount{ 0 };
+    };
+}
@@ -1,29 +1,124 @@
 #pragma once
 #include <cstdint>
-#include <typeinfo>
-#include <typeindex>
+#include <cstddef>
+#include <bitset>
+#include <concepts>
+#include <atomic>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
 
 namespace Nexus
 {
-    // Entity ID type - simple uint32 with special values
+    // Entity ID type - uint32 packing an index (low bits) and a generation (high bits).
+    // The generation is bumped every time an index is recycled, so stale IDs never alias new entities.
     using EntityID = uint32_t;
 
-    // Component type identifier
-    using ComponentTypeID = std::type_index;
+    // Component type identifier - dense index in [0, MAX_COMPONENTS), assigned on first use
+    using ComponentTypeID = uint32_t;
 
     // Constants
     constexpr EntityID NULL_ENTITY = 0;
     constexpr EntityID MAX_ENTITIES = 1000000; // 1 million entities max
     constexpr size_t MAX_COMPONENTS = 128;      // 128 different component types max
+    constexpr size_t SPARSE_PAGE_SIZE = 4096;   // Entities per lazily allocated sparse page
+    constexpr size_t CACHE_LINE_SIZE = 64;      // Parallel iteration splits packed arrays on this boundary
+
+    // Entity ID layout
+    constexpr uint32_t ENTITY_INDEX_BITS = 20;
+    constexpr EntityID ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+    constexpr EntityID ENTITY_VERSION_MASK = (1u << (32 - ENTITY_INDEX_BITS)) - 1;
+    static_assert(MAX_ENTITIES <= ENTITY_INDEX_MASK, "Entity index bits cannot address MAX_ENTITIES");
+
+    constexpr EntityID GetEntityIndex(EntityID id) { return id & ENTITY_INDEX_MASK; }
+    constexpr EntityID GetEntityVersion(EntityID id) { return id >> ENTITY_INDEX_BITS; }
+    constexpr EntityID MakeEntityID(EntityID index, EntityID version) { return (version << ENTITY_INDEX_BITS) | index; }
+
+    // The highest generation is never issued to live entities; command buffers use it to tag
+    // placeholder entities that only get a real ID at playback
+    constexpr EntityID PLACEHOLDER_ENTITY_VERSION = ENTITY_VERSION_MASK;
+    constexpr bool IsPlaceholderEntity(EntityID id) { return GetEntityVersion(id) == PLACEHOLDER_ENTITY_VERSION; }
+
+    // Set of component types attached to an entity
+    using ComponentSignature = std::bitset<MAX_COMPONENTS>;
+
+    // Helper for generating component type IDs.
+    // Each component type draws the next dense ID the first time it is used, so IDs index flat
+    // arrays directly and no RTTI is needed. IDs are stable for the lifetime of the process only.
+    inline ComponentTypeID NextComponentTypeID()
+    {
+        static std::atomic<ComponentTypeID> s_NextID{ 0 };
+
+        ComponentTypeID id = s_NextID.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MAX_COMPONENTS)
+            throw std::runtime_error("Too many component types");
+        return id;
+    }
 
-    // Helper for generating component type IDs
     template<typename T>
     ComponentTypeID GetComponentTypeID()
     {
-        return std::type_index(typeid(T));
+        if constexpr (!std::is_same_v<T, std::remove_cv_t<T>>)
+        {
+            return GetComponentTypeID<std::remove_cv_t<T>>();
+        }
+        else
+        {
+            static const ComponentTypeID s_ID = NextComponentTypeID();
+            return s_ID;
+        }
+    }
+
+    // Readable name of T taken from the compiler's function signature (no RTTI), e.g. "Transform".
+    // The Nexus namespace is dropped; other namespaces are kept.
+    template<typename T>
+    constexpr std::string_view GetTypeName()
+    {
+#if defined(_MSC_VER)
+        std::string_view name = __FUNCSIG__;
+        size_t begin = name.find("GetTypeName<") + 12;
+        name = name.substr(begin, name.rfind(">(void)") - begin);
+        for (std::string_view keyword : { "class ", "struct ", "enum " })
+        {
+            if (name.starts_with(keyword))
+                name.remove_prefix(keyword.size());
+        }
+#else
+        std::string_view name = __PRETTY_FUNCTION__;
+        size_t begin = name.find("T = ") + 4;
+        name = name.substr(begin, name.find_first_of(";]", begin) - begin);
+#endif
+        if (name.starts_with("Nexus::"))
+            name.remove_prefix(7);
+        return name;
     }
 
     // Component storage index type
     using ComponentIndex = size_t;
     constexpr ComponentIndex INVALID_COMPONENT_INDEX = SIZE_MAX;
+
+    // Change-detection tick. The Registry advances it (at least) once per system run; storages
+    // stamp components with the current tick when they are added or accessed mutably.
+    // Tick 0 is never current, so "changed since 0" matches every component.
+    // 64-bit so the plain ">" compares never see a wrap: a 32-bit tick advanced per system run
+    // wraps in under a day at a thousand runs per 60 Hz frame, after which old components look new.
+    using Tick = uint64_t;
+
+    // Tick source for storages that are not owned by a Registry
+    inline const std::atomic<Tick> NULL_TICK_SOURCE{ 0 };
+
+    // Entity/component/view API shared by the storage backends (Registry, ArchetypeRegistry).
+    // Code templated on an EntityRegistry compiles against either one.
+    template<typename TRegistry>
+    concept EntityRegistry = requires(TRegistry& registry, typename TRegistry::EntityHandle entity)
+    {
+        { registry.CreateEntity() } -> std::same_as<typename TRegistry::EntityHandle>;
+        registry.DestroyEntity(entity);
+        { registry.IsValidEntity(entity) } -> std::convertible_to<bool>;
+        registry.template AddComponent<int>(entity);
+        registry.template GetComponent<int>(entity);
+        { registry.template HasComponent<int>(entity) } -> std::convertible_to<bool>;
+        registry.template RemoveComponent<int>(entity);
+        registry.template View<int>();
+    };
 }
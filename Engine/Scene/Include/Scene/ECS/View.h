@@ -0,0 +1,231 @@
+#pragma once
+#include "Types.h"
+#include "Entity.h"
+#include "Component.h"
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <type_traits>
+
+namespace Nexus
+{
+    class Registry; // Forward declaration
+    class JobSystem;
+
+    // Component types an entity must NOT have to be part of a view
+    template<typename... TExcluded>
+    struct ExcludeList {};
+
+    template<typename... TExcluded>
+    inline constexpr ExcludeList<TExcluded...> Exclude{};
+
+    // Storage used for a (possibly const-qualified) view component type
+    template<typename T>
+    using ViewStorage = ComponentStorage<std::remove_const_t<T>>;
+
+    template<typename TExclude, typename... TComponents>
+    class BasicView;
+
+    // View over all entities that have every component in TComponents and none in TExcluded.
+    // Iteration is driven by the smallest included storage; the remaining components are
+    // fetched straight from their storages, without going through Entity.
+    // Use const component types (e.g. View<const Transform>) for read-only access; non-const
+    // components are marked changed when the view hands them out.
+    //
+    // Changed<T>(tick) and Added<T>(tick) narrow the view to entities whose T was changed or
+    // added after the given tick, typically the last tick a system ran at.
+    // Tag (empty) components work as included or excluded types; matching them is a bit test.
+    template<typename... TExcluded, typename... TComponents>
+    class BasicView<ExcludeList<TExcluded...>, TComponents...>
+    {
+        static_assert(sizeof...(TComponents) > 0, "A view needs at least one component type");
+
+    public:
+        using StorageTuple = std::tuple<ViewStorage<TComponents>*...>;
+        using ExcludedTuple = std::tuple<ComponentStorage<TExcluded>*...>;
+
+        BasicView(Registry* registry, StorageTuple storages, ExcludedTuple excluded)
+            : m_Registry(registry), m_Storages(storages), m_Excluded(excluded), m_Driver(nullptr)
+        {
+            // A missing included storage means no entity can match
+            bool complete = std::apply([](auto*... storage) { return ((storage != nullptr) && ...); }, m_Storages);
+            if (!complete)
+                return;
+
+            // Drive iteration with the smallest storage
+            std::apply([this](auto*... storage)
+                {
+                    ((m_Driver = (!m_Driver || storage->GetEntities().size() < m_Driver->size()) ? &storage->GetEntities() : m_Driver), ...);
+                }, m_Storages);
+        }
+
+        class Iterator
+        {
+        public:
+            Iterator(const BasicView* view, size_t index)
+                : m_View(view), m_Index(index)
+            {
+                SkipNonMatching();
+            }
+
+            std::tuple<Entity, TComponents&...> operator*() const
+            {
+                EntityID entityID = (*m_View->m_Driver)[m_Index];
+                return std::tuple<Entity, TComponents&...>(
+                    Entity(entityID, m_View->m_Registry),
+                    Fetch<TComponents>(m_View->m_Storages, entityID)...);
+            }
+
+            Iterator& operator++()
+            {
+                ++m_Index;
+                SkipNonMatching();
+                return *this;
+            }
+
+            bool operator==(const Iterator& other) const { return m_Index == other.m_Index; }
+            bool operator!=(const Iterator& other) const { return m_Index != other.m_Index; }
+
+        private:
+            void SkipNonMatching()
+            {
+                size_t size = m_View->m_Driver ? m_View->m_Driver->size() : 0;
+                while (m_Index < size && !m_View->IsMatch((*m_View->m_Driver)[m_Index]))
+                    ++m_Index;
+            }
+
+            const BasicView* m_View;
+            size_t m_Index;
+        };
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, m_Driver ? m_Driver->size() : 0); }
+
+        // Call func(Entity, TComponents&...) for every matching entity
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            if (!m_Driver)
+                return;
+
+            const std::pmr::vector<EntityID>& entities = *m_Driver;
+            for (size_t i = 0; i < entities.size(); i++)
+            {
+                EntityID entityID = entities[i];
+                if (!IsMatch(entityID))
+                    continue;
+
+                func(Entity(entityID, m_Registry),
+                    Fetch<TComponents>(m_Storages, entityID)...);
+            }
+        }
+
+        // Call func(Entity, TComponents&...) for every matching entity, spread across the job
+        // system's threads. The driving storage is split into batches whose size is a multiple of
+        // a cache line's worth of every included type, which keeps false sharing to the batch
+        // edges. It is not ruled out: the packed and tick arrays are not cache-line aligned, and
+        // components of the other storages are reached by lookup, so two batches can still
+        // write to one line. batchSize == 0 picks a size from the entity and thread counts.
+        //
+        // The callback runs concurrently: it must not create or destroy entities or add/remove
+        // components (record those in an EntityCommandBuffer instead), and it must only write
+        // to the components it is given. Debug builds assert on structural changes meanwhile.
+        // Implemented in Registry.h.
+        template<typename Func>
+        void ParallelForEach(JobSystem& jobs, const Func& func, size_t batchSize = 0) const;
+
+        // Only entities whose T was changed (accessed mutably or added) after sinceTick
+        template<typename T>
+        BasicView Changed(Tick sinceTick) const
+        {
+            static_assert(ComponentPosition<T>() < COMPONENT_COUNT, "Tick filters need a component of the view");
+            static_assert(!std::is_empty_v<T>, "Tag components are not change-tracked");
+            BasicView view = *this;
+            view.m_ChangedSince[ComponentPosition<T>()] = sinceTick;
+            view.m_HasTickFilter = true;
+            return view;
+        }
+
+        // Only entities whose T was added after sinceTick
+        template<typename T>
+        BasicView Added(Tick sinceTick) const
+        {
+            static_assert(ComponentPosition<T>() < COMPONENT_COUNT, "Tick filters need a component of the view");
+            static_assert(!std::is_empty_v<T>, "Tag components are not change-tracked");
+            BasicView view = *this;
+            view.m_AddedSince[ComponentPosition<T>()] = sinceTick;
+            view.m_HasTickFilter = true;
+            return view;
+        }
+
+        // Check if an entity is part of this view
+        bool Contains(Entity entity) const
+        {
+            return m_Driver && IsMatch(entity.GetID());
+        }
+
+        // Upper bound on the number of matching entities (size of the driving storage)
+        size_t SizeHint() const { return m_Driver ? m_Driver->size() : 0; }
+
+    private:
+        // Smallest element count that is a whole number of cache lines for every included type
+        static constexpr size_t GetCacheLineGranularity()
+        {
+            size_t granularity = CACHE_LINE_SIZE / sizeof(EntityID);
+            ((granularity = std::max(granularity, CACHE_LINE_SIZE / std::gcd(sizeof(TComponents), CACHE_LINE_SIZE))), ...);
+            return granularity;
+        }
+
+        static constexpr size_t COMPONENT_COUNT = sizeof...(TComponents);
+
+        // Position of T among TComponents (const-qualification ignored)
+        template<typename T>
+        static constexpr size_t ComponentPosition()
+        {
+            constexpr bool matches[] = { std::is_same_v<std::remove_const_t<T>, std::remove_const_t<TComponents>>... };
+            for (size_t i = 0; i < COMPONENT_COUNT; i++)
+            {
+                if (matches[i])
+                    return i;
+            }
+            return COMPONENT_COUNT;
+        }
+
+        // Fetch a component for the callback; only non-const access marks it changed
+        template<typename T>
+        static T& Fetch(const StorageTuple& storages, EntityID entityID)
+        {
+            if constexpr (std::is_const_v<T>)
+                return static_cast<const ViewStorage<T>*>(std::get<ViewStorage<T>*>(storages))->GetComponentUnchecked(entityID);
+            else
+                return std::get<ViewStorage<T>*>(storages)->GetComponentUnchecked(entityID);
+        }
+
+        bool IsMatch(EntityID entityID) const
+        {
+            bool hasAll = std::apply([entityID](auto*... storage) { return (storage->HasComponent(entityID) && ...); }, m_Storages);
+            bool hasExcluded = std::apply([entityID](auto*... storage) { return ((storage && storage->HasComponent(entityID)) || ...); }, m_Excluded);
+            return hasAll && !hasExcluded && (!m_HasTickFilter || PassesTickFilters(entityID, std::index_sequence_for<TComponents...>{}));
+        }
+
+        template<size_t... Indices>
+        bool PassesTickFilters(EntityID entityID, std::index_sequence<Indices...>) const
+        {
+            return ((std::get<Indices>(m_Storages)->GetChangedTick(entityID) > m_ChangedSince[Indices] &&
+                std::get<Indices>(m_Storages)->GetAddedTick(entityID) > m_AddedSince[Indices]) && ...);
+        }
+
+        Registry* m_Registry;
+        StorageTuple m_Storages;
+        ExcludedTuple m_Excluded;
+        const std::pmr::vector<EntityID>* m_Driver;  // Entity list of the smallest included storage
+
+        // Per-component tick filters; 0 lets everything through
+        std::array<Tick, COMPONENT_COUNT> m_ChangedSince{};
+        std::array<Tick, COMPONENT_COUNT> m_AddedSince{};
+        bool m_HasTickFilter = false;
+    };
+}
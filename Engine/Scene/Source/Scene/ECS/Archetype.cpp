@@ -0,0 +1,130 @@
+#include "Scene/ECS/Archetype.h"
+#include <algorithm>
+
+namespace Nexus
+{
+    static constexpr size_t CHUNK_ALIGNMENT = 64;
+
+    static size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    Archetype::Archetype(std::vector<const ComponentTypeInfo*> types)
+        : m_Types(std::move(types))
+    {
+        std::sort(m_Types.begin(), m_Types.end(),
+            [](const ComponentTypeInfo* a, const ComponentTypeInfo* b) { return a->id < b->id; });
+
+        // Bytes needed per entity, plus worst-case padding between columns
+        size_t rowBytes = sizeof(EntityID);
+        size_t paddingBytes = 0;
+        for (const ComponentTypeInfo* type : m_Types)
+        {
+            rowBytes += type->size;
+            paddingBytes += type->alignment;
+        }
+
+        // Very large component sets get bigger chunks so a chunk always holds at least one entity
+        m_ChunkBytes = std::max(ARCHETYPE_CHUNK_SIZE, AlignUp(rowBytes + paddingBytes, CHUNK_ALIGNMENT));
+        m_ChunkCapacity = std::max<size_t>(1, (m_ChunkBytes - paddingBytes) / rowBytes);
+
+        // Lay out columns: entity IDs first, then each component type, each aligned
+        size_t offset = m_ChunkCapacity * sizeof(EntityID);
+        for (size_t column = 0; column < m_Types.size(); column++)
+        {
+            const ComponentTypeInfo* type = m_Types[column];
+            offset = AlignUp(offset, type->alignment);
+            m_ColumnOffsets.push_back(offset);
+            offset += m_ChunkCapacity * type->size;
+
+            m_Signature.set(type->id);
+            m_ColumnLookup[type->id] = static_cast<uint8_t>(column);
+        }
+    }
+
+    Archetype::~Archetype()
+    {
+        // Destroy live components
+        for (size_t column = 0; column < m_Types.size(); column++)
+        {
+            for (size_t row = 0; row < m_Count; row++)
+            {
+                m_Types[column]->destroy(GetComponent(row, column));
+            }
+        }
+
+        for (std::byte* chunk : m_Chunks)
+        {
+            ::operator delete(chunk, std::align_val_t(CHUNK_ALIGNMENT));
+        }
+    }
+
+    size_t Archetype::AllocateRow(EntityID entity)
+    {
+        size_t row = m_Count;
+        size_t chunk = row / m_ChunkCapacity;
+
+        if (chunk >= m_Chunks.size())
+        {
+            m_Chunks.push_back(static_cast<std::byte*>(::operator new(m_ChunkBytes, std::align_val_t(CHUNK_ALIGNMENT))));
+        }
+
+        GetChunkEntities(chunk)[row % m_ChunkCapacity] = entity;
+        m_Count++;
+        return row;
+    }
+
+    EntityID Archetype::RemoveRow(size_t row)
+    {
+        for (size_t column = 0; column < m_Types.size(); column++)
+        {
+            m_Types[column]->destroy(GetComponent(row, column));
+        }
+
+        return FillHole(row);
+    }
+
+    size_t Archetype::MoveRow(size_t row, Archetype& destination, EntityID& movedEntity)
+    {
+        size_t destinationRow = destination.AllocateRow(GetEntity(row));
+
+        for (size_t column = 0; column < m_Types.size(); column++)
+        {
+            void* source = GetComponent(row, column);
+            size_t destinationColumn = destination.GetColumn(m_Types[column]->id);
+
+            if (destinationColumn != INVALID_COLUMN)
+            {
+                m_Types[column]->moveConstruct(destination.GetComponent(destinationRow, destinationColumn), source);
+            }
+            m_Types[column]->destroy(source);
+        }
+
+        movedEntity = FillHole(row);
+        return destinationRow;
+    }
+
+    EntityID Archetype::FillHole(size_t row)
+    {
+        // The row's components are already destroyed; move the last row into it
+        size_t lastRow = m_Count - 1;
+        EntityID movedEntity = NULL_ENTITY;
+
+        if (row != lastRow)
+        {
+            for (size_t column = 0; column < m_Types.size(); column++)
+            {
+                void* last = GetComponent(lastRow, column);
+                m_Types[column]->moveConstruct(GetComponent(row, column), last);
+                m_Types[column]->destroy(last);
+            }
+
+            movedEntity = GetEntity(lastRow);
+            GetChunkEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity] = movedEntity;
+        }
+
+        m_Count--;
+        return movedEntity;
+    }
+}
@@ -0,0 +1,171 @@
+#include "Scene/ECS/EntityCommandBuffer.h"
+#include <algorithm>
+
+namespace Nexus
+{
+    static constexpr size_t PAYLOAD_BLOCK_SIZE = 16 * 1024;
+
+    EntityCommandBuffer::~EntityCommandBuffer()
+    {
+        Clear();
+    }
+
+    // Offset of the first address at or after block + offset that is aligned to alignment.
+    // The address is aligned, not the offset: blocks only have new[]'s alignment.
+    static size_t AlignPayloadOffset(const std::byte* block, size_t offset, size_t alignment)
+    {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block);
+        return ((base + offset + alignment - 1) & ~(std::uintptr_t(alignment) - 1)) - base;
+    }
+
+    void* EntityCommandBuffer::AllocatePayload(size_t size, size_t alignment)
+    {
+        size_t offset = m_Blocks.empty() ? 0 : AlignPayloadOffset(m_Blocks.back().get(), m_BlockOffset, alignment);
+
+        if (m_Blocks.empty() || offset + size > m_BlockSize)
+        {
+            // Blocks are never reallocated, so recorded payloads keep their address
+            m_BlockSize = std::max(PAYLOAD_BLOCK_SIZE, size + alignment);
+            m_Blocks.push_back(std::make_unique<std::byte[]>(m_BlockSize));
+            offset = AlignPayloadOffset(m_Blocks.back().get(), 0, alignment);
+        }
+
+        m_BlockOffset = offset + size;
+        return m_Blocks.back().get() + offset;
+    }
+
+    void EntityCommandBuffer::ReserveEntities(Registry& registry, size_t count)
+    {
+        if (!m_ReservedEntities.empty() && m_ReservedRegistry != &registry)
+            throw std::runtime_error("Command buffer holds entity IDs reserved from another registry");
+
+        size_t first = m_ReservedEntities.size();
+        m_ReservedEntities.resize(first + count);
+        registry.ReserveEntities(count, std::span<Entity>(m_ReservedEntities).subspan(first));
+        m_ReservedRegistry = &registry;
+    }
+
+    Entity EntityCommandBuffer::ReserveEntity(Registry& registry)
+    {
+        if (m_ReservedEntities.empty())
+            ReserveEntities(registry, 1);
+        else if (m_ReservedRegistry != &registry)
+            throw std::runtime_error("Command buffer holds entity IDs reserved from another registry");
+
+        Entity entity = m_ReservedEntities.back();
+        m_ReservedEntities.pop_back();
+        return entity;
+    }
+
+    void EntityCommandBuffer::Clear()
+    {
+        for (const Command& command : m_Commands)
+        {
+            if (command.payload)
+                command.ops->destroy(command.payload);
+        }
+
+        // Reserved IDs nobody used go back to the free list; otherwise the next flush would
+        // make them alive as entities without components
+        if (!m_ReservedEntities.empty())
+        {
+            m_ReservedRegistry->ReleaseReservedEntities(m_ReservedEntities);
+            m_ReservedEntities.clear();
+        }
+
+        m_Commands.clear();
+        m_Blocks.clear();
+        m_BlockOffset = 0;
+        m_BlockSize = 0;
+        m_PlaceholderCount = 0;
+    }
+
+    void EntityCommandBuffer::Playback(Registry& registry)
+    {
+        EntityCommandBuffer* buffer = this;
+        Playback(registry, std::span<EntityCommandBuffer* const>(&buffer, 1));
+    }
+
+    void EntityCommandBuffer::Playback(Registry& registry, std::span<EntityCommandBuffer* const> buffers)
+    {
+        struct PendingCommand
+        {
+            const Command* command;
+            EntityID entity;        // Resolved live entity
+        };
+
+        // Entities reserved by jobs become alive before their commands are applied
+        registry.FlushReservedEntities();
+
+        std::vector<PendingCommand> componentCommands;
+        std::vector<EntityID> destroys;
+        std::vector<Entity> placeholders;
+
+        for (EntityCommandBuffer* buffer : buffers)
+        {
+            // Creates first, all of the buffer's placeholders in one batch, so they can be resolved
+            placeholders.resize(buffer->m_PlaceholderCount);
+            registry.CreateEntities(placeholders.size(), placeholders);
+
+            auto resolve = [&placeholders](EntityID entity)
+            {
+                if (!IsPlaceholderEntity(entity))
+                    return entity;
+                EntityID index = GetEntityIndex(entity);
+                return index < placeholders.size() ? placeholders[index].GetID() : NULL_ENTITY;
+            };
+
+            for (const Command& command : buffer->m_Commands)
+            {
+                if (command.type == CommandType::Add || command.type == CommandType::Remove)
+                    componentCommands.push_back({ &command, resolve(command.entity) });
+                else if (command.type == CommandType::Destroy)
+                    destroys.push_back(resolve(command.entity));
+            }
+        }
+
+        // Group component commands by type; stable so recorded order is kept within a type
+        std::stable_sort(componentCommands.begin(), componentCommands.end(),
+            [](const PendingCommand& a, const PendingCommand& b) { return a.command->typeID < b.command->typeID; });
+
+        for (size_t first = 0; first < componentCommands.size();)
+        {
+            // Find the run of commands for this component type
+            size_t last = first;
+            size_t addCount = 0;
+            while (last < componentCommands.size() && componentCommands[last].command->typeID == componentCommands[first].command->typeID)
+            {
+                addCount += componentCommands[last].command->type == CommandType::Add ? 1 : 0;
+                last++;
+            }
+
+            if (addCount > 0)
+                componentCommands[first].command->ops->reserve(registry, addCount);
+
+            for (size_t i = first; i < last; i++)
+            {
+                const PendingCommand& pending = componentCommands[i];
+                Entity entity(pending.entity, &registry);
+                if (!registry.IsValidEntity(entity))
+                    continue;
+
+                if (pending.command->type == CommandType::Add)
+                    pending.command->ops->add(registry, entity, pending.command->payload);
+                else
+                    pending.command->ops->remove(registry, entity);
+            }
+
+            first = last;
+        }
+
+        for (EntityID id : destroys)
+        {
+            registry.DestroyEntity(Entity(id, &registry));
+        }
+
+        for (EntityCommandBuffer* buffer : buffers)
+        {
+            buffer->Clear();
+        }
+    }
+}
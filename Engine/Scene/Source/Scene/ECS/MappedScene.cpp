@@ -0,0 +1,43 @@
+#include "Scene/ECS/MappedScene.h"
+#include <stdexcept>
+
+namespace Nexus
+{
+    MappedScene::MappedScene(const std::string& path, MappedFile::Access access)
+        : m_File(path, access)
+    {
+        // Only the block headers and the string table are touched here; column pages fault in
+        // on first use
+        m_Columns = RegistrySnapshot::ReadBlocks(m_File.GetData(), m_Strings);
+        m_Remapped.assign(m_Columns.size(), 0);
+    }
+
+    std::span<const EntityID> MappedScene::GetEntities(const std::string& name) const
+    {
+        const RegistrySnapshot::BlockInfo* column = FindColumn(name);
+        if (!column)
+            throw std::runtime_error("Scene has no component column: " + name);
+
+        return std::span<const EntityID>(reinterpret_cast<const EntityID*>(m_File.GetData().data() + column->entitiesOffset), column->count);
+    }
+
+    const RegistrySnapshot::BlockInfo* MappedScene::FindColumn(const std::string& name) const
+    {
+        for (const RegistrySnapshot::BlockInfo& column : m_Columns)
+        {
+            if (column.name == name)
+                return &column;
+        }
+        return nullptr;
+    }
+
+    const RegistrySnapshot::BlockInfo& MappedScene::GetColumn(const std::string& name, size_t elementSize) const
+    {
+        const RegistrySnapshot::BlockInfo* column = FindColumn(name);
+        if (!column)
+            throw std::runtime_error("Scene has no component column: " + name);
+        if (!column->raw || column->elementSize != elementSize)
+            throw std::runtime_error("Component column '" + name + "' does not hold packed components of this type");
+        return *column;
+    }
+}
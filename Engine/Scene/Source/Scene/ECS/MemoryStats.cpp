@@ -0,0 +1,61 @@
+#include "Scene/ECS/MemoryStats.h"
+#include <cstdio>
+
+namespace Nexus
+{
+    size_t RegistryMemoryStats::GetTotalBytes() const
+    {
+        size_t total = entityBytes;
+        for (const StorageMemoryStats& storage : storages)
+        {
+            total += storage.GetTotalBytes();
+        }
+        return total;
+    }
+
+    size_t RegistryMemoryStats::GetWastedBytes() const
+    {
+        size_t wasted = 0;
+        for (const StorageMemoryStats& storage : storages)
+        {
+            wasted += storage.wastedBytes;
+        }
+        return wasted;
+    }
+
+    std::string RegistryMemoryStats::ToJson() const
+    {
+        std::string json = "{\"aliveEntities\":" + std::to_string(aliveEntities) +
+            ",\"peakEntities\":" + std::to_string(peakEntities) +
+            ",\"freeListLength\":" + std::to_string(freeListLength) +
+            ",\"entityBytes\":" + std::to_string(entityBytes) +
+            ",\"totalBytes\":" + std::to_string(GetTotalBytes()) +
+            ",\"wastedBytes\":" + std::to_string(GetWastedBytes()) +
+            ",\"storages\":[";
+
+        for (size_t i = 0; i < storages.size(); i++)
+        {
+            const StorageMemoryStats& storage = storages[i];
+            char fragmentation[32];
+            std::snprintf(fragmentation, sizeof(fragmentation), "%.4f", storage.fragmentation);
+
+            // Type names are C++ identifiers, so they need no escaping
+            json += (i ? ",{" : "{");
+            json += "\"type\":\"" + std::string(storage.typeName) + "\"" +
+                ",\"typeID\":" + std::to_string(storage.typeID) +
+                ",\"elementSize\":" + std::to_string(storage.elementSize) +
+                ",\"count\":" + std::to_string(storage.count) +
+                ",\"capacity\":" + std::to_string(storage.capacity) +
+                ",\"componentBytes\":" + std::to_string(storage.componentBytes) +
+                ",\"entityBytes\":" + std::to_string(storage.entityBytes) +
+                ",\"tickBytes\":" + std::to_string(storage.tickBytes) +
+                ",\"indexBytes\":" + std::to_string(storage.indexBytes) +
+                ",\"wastedBytes\":" + std::to_string(storage.wastedBytes) +
+                ",\"sparsePages\":" + std::to_string(storage.sparsePages) +
+                ",\"fragmentation\":" + fragmentation + "}";
+        }
+
+        json += "]}";
+        return json;
+    }
+}
@@ -0,0 +1,23 @@
+#include "Scene/ECS/Prefab.h"
+
+namespace Nexus
+{
+    void Prefab::Instantiate(Registry& registry, size_t count, std::span<Entity> out) const
+    {
+        registry.CreateEntities(count, out);
+
+        // One bulk add per component type keeps each storage's new entries contiguous
+        std::span<const Entity> instances = out.first(count);
+        for (const ComponentEntry& entry : m_Components)
+        {
+            entry.stamp(registry, instances, entry.prototype.get());
+        }
+    }
+
+    Entity Prefab::Instantiate(Registry& registry) const
+    {
+        Entity entity;
+        Instantiate(registry, 1, std::span<Entity>(&entity, 1));
+        return entity;
+    }
+}
@@ -1,8 +1,319 @@
 #include "Scene/ECS/Registry.h"
+#include "Scene/ECS/Components/Name.h"
 #include "Core/Logger.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
 
 namespace Nexus
 {
     // Registry implementation is mostly in the header due to templates
-    // This file exists for future non-template implementations and logging
+
+    void Registry::OnStorageCreated(ComponentTypeID typeID, ComponentStorageBase& storage)
+    {
+        if (typeID == GetComponentTypeID<Name>())
+        {
+            storage.OnConstruct().Connect<&Registry::OnNameConstruct>(this);
+            storage.OnUpdate().Connect<&Registry::OnNameUpdate>(this);
+            storage.OnDestroy().Connect<&Registry::OnNameDestroy>(this);
+        }
+        else if (typeID == GetComponentTypeID<Relationship>())
+        {
+            storage.OnDestroy().Connect<&Registry::OnRelationshipDestroy>(this);
+        }
+    }
+
+    void Registry::OnNameConstruct(Registry&, Entity entity)
+    {
+        IndexName(entity.GetID());
+    }
+
+    void Registry::OnNameUpdate(Registry&, Entity entity)
+    {
+        // Patch/Replace may have changed the name; move the entity to its new list
+        EntityID id = entity.GetID();
+        if (m_NameSlots[GetEntityIndex(id)].name != GetComponentStorage<Name>()->GetComponentUnchecked(id).name)
+        {
+            UnindexName(id);
+            IndexName(id);
+        }
+    }
+
+    void Registry::OnNameDestroy(Registry&, Entity entity)
+    {
+        UnindexName(entity.GetID());
+    }
+
+    void Registry::IndexName(EntityID entity)
+    {
+        EntityID index = GetEntityIndex(entity);
+        if (m_NameSlots.size() <= index)
+            m_NameSlots.resize(m_EntityPool.GetIndexCount());
+
+        StringID name = GetComponentStorage<Name>()->GetComponentUnchecked(entity).name;
+        std::pmr::vector<EntityID>& entities = m_NameIndex[name];
+        m_NameSlots[index] = { name, static_cast<uint32_t>(entities.size()) };
+        entities.push_back(entity);
+    }
+
+    void Registry::UnindexName(EntityID entity)
+    {
+        const NameIndexSlot& slot = m_NameSlots[GetEntityIndex(entity)];
+        auto it = m_NameIndex.find(slot.name);
+        std::pmr::vector<EntityID>& entities = it->second;
+
+        // Swap-remove, keeping the moved entity's position up to date
+        EntityID last = entities.back();
+        entities[slot.position] = last;
+        m_NameSlots[GetEntityIndex(last)].position = slot.position;
+        entities.pop_back();
+        if (entities.empty())
+            m_NameIndex.erase(it);
+    }
+
+    Entity Registry::FindEntityByName(StringID name)
+    {
+        std::span<const EntityID> entities = FindEntitiesByName(name);
+        return entities.empty() ? Entity() : Entity(entities.front(), this);
+    }
+
+    Entity Registry::FindEntityByName(std::string_view name)
+    {
+        // A string that was never interned cannot be anyone's name
+        std::optional<StringID> id = StringTable::Get().Find(name);
+        return id ? FindEntityByName(*id) : Entity();
+    }
+
+    std::span<const EntityID> Registry::FindEntitiesByName(StringID name) const
+    {
+        auto it = m_NameIndex.find(name);
+        if (it == m_NameIndex.end())
+            return {};
+        return it->second;
+    }
+
+    void Registry::OnRelationshipDestroy(Registry&, Entity entity)
+    {
+        ComponentStorage<Relationship>* relationships = GetComponentStorage<Relationship>();
+        Relationship& relationship = relationships->GetComponentUnchecked(entity.GetID());
+        UnlinkFromParent(relationship);
+
+        // Children become roots
+        EntityID child = relationship.firstChild;
+        while (child != NULL_ENTITY)
+        {
+            Relationship& childRelationship = relationships->GetComponentUnchecked(child);
+            child = childRelationship.nextSibling;
+            childRelationship.parent = NULL_ENTITY;
+            childRelationship.nextSibling = NULL_ENTITY;
+            childRelationship.prevSibling = NULL_ENTITY;
+        }
+        relationship.firstChild = NULL_ENTITY;
+        relationship.childCount = 0;
+
+        // The storage moves its last entry into the freed slot, possibly ahead of its parent
+        m_HierarchySorted = false;
+    }
+
+    void Registry::UnlinkFromParent(Relationship& relationship)
+    {
+        if (relationship.parent == NULL_ENTITY)
+            return;
+
+        ComponentStorage<Relationship>* relationships = GetComponentStorage<Relationship>();
+        Relationship& parent = relationships->GetComponentUnchecked(relationship.parent);
+        if (relationship.prevSibling != NULL_ENTITY)
+            relationships->GetComponentUnchecked(relationship.prevSibling).nextSibling = relationship.nextSibling;
+        else
+            parent.firstChild = relationship.nextSibling;
+
+        if (relationship.nextSibling != NULL_ENTITY)
+            relationships->GetComponentUnchecked(relationship.nextSibling).prevSibling = relationship.prevSibling;
+
+        parent.childCount--;
+        relationship.parent = NULL_ENTITY;
+        relationship.nextSibling = NULL_ENTITY;
+        relationship.prevSibling = NULL_ENTITY;
+    }
+
+    void Registry::SetParent(Entity child, Entity parent)
+    {
+        AssertStructuralChangesAllowed();
+        EntityID childID = child.GetID();
+        EntityID parentID = parent.GetID();
+        if (!IsValidEntity(child) || (parentID != NULL_ENTITY && !IsValidEntity(parent)))
+            throw std::runtime_error("Invalid entity");
+        if (childID == parentID)
+            throw std::runtime_error("An entity cannot be its own parent");
+
+        // Add both before taking references, adding may move the packed array
+        if (!HasComponent<Relationship>(child))
+            AddComponent<Relationship>(child);
+        if (parentID != NULL_ENTITY && !HasComponent<Relationship>(parent))
+            AddComponent<Relationship>(parent);
+
+        ComponentStorage<Relationship>* relationships = GetComponentStorage<Relationship>();
+        Relationship& relationship = relationships->GetComponentUnchecked(childID);
+        if (relationship.parent == parentID)
+            return;
+
+        // Only an entity with children can be an ancestor of the new parent
+        if (parentID != NULL_ENTITY && relationship.HasChildren())
+        {
+            for (EntityID ancestor = parentID; ancestor != NULL_ENTITY;
+                ancestor = std::as_const(*relationships).GetComponentUnchecked(ancestor).parent)
+            {
+                if (ancestor == childID)
+                    throw std::runtime_error("Cannot parent an entity to one of its descendants");
+            }
+        }
+
+        UnlinkFromParent(relationship);
+        if (parentID == NULL_ENTITY)
+            return;
+
+        Relationship& parentRelationship = relationships->GetComponentUnchecked(parentID);
+        relationship.parent = parentID;
+        relationship.nextSibling = parentRelationship.firstChild;
+        if (parentRelationship.firstChild != NULL_ENTITY)
+            relationships->GetComponentUnchecked(parentRelationship.firstChild).prevSibling = childID;
+        parentRelationship.firstChild = childID;
+        parentRelationship.childCount++;
+
+        if (relationships->GetIndex(parentID) > relationships->GetIndex(childID))
+            m_HierarchySorted = false;
+    }
+
+    Entity Registry::GetParent(Entity entity)
+    {
+        if (!HasComponent<Relationship>(entity))
+            return Entity();
+
+        EntityID parent = std::as_const(*GetComponentStorage<Relationship>()).GetComponentUnchecked(entity.GetID()).parent;
+        return parent == NULL_ENTITY ? Entity() : Entity(parent, this);
+    }
+
+    void Registry::SortRelationships()
+    {
+        ComponentStorage<Relationship>* relationships = GetSortableStorage<Relationship>();
+        if (!relationships)
+        {
+            m_HierarchySorted = true;
+            return;
+        }
+        const ComponentStorage<Relationship>& links = *relationships;
+
+        // Depth per entity index, resolved by walking up to the first known ancestor
+        constexpr uint32_t UNKNOWN_DEPTH = UINT32_MAX;
+        std::vector<uint32_t> depths(m_EntityPool.GetIndexCount(), UNKNOWN_DEPTH);
+        std::vector<EntityID> path;
+        for (EntityID entity : links.GetEntities())
+        {
+            EntityID current = entity;
+            while (current != NULL_ENTITY && depths[GetEntityIndex(current)] == UNKNOWN_DEPTH)
+            {
+                path.push_back(current);
+                current = links.GetComponentUnchecked(current).parent;
+            }
+
+            uint32_t depth = current == NULL_ENTITY ? 0 : depths[GetEntityIndex(current)] + 1;
+            for (auto it = path.rbegin(); it != path.rend(); ++it)
+            {
+                depths[GetEntityIndex(*it)] = depth++;
+            }
+            path.clear();
+        }
+
+        // By depth, then by parent so siblings end up next to each other
+        auto depthOf = [&depths](const Relationship& relationship)
+        {
+            return relationship.parent == NULL_ENTITY ? 0 : depths[GetEntityIndex(relationship.parent)] + 1;
+        };
+        relationships->Sort([&depthOf](const Relationship& a, const Relationship& b)
+            {
+                uint32_t depthA = depthOf(a);
+                uint32_t depthB = depthOf(b);
+                return depthA != depthB ? depthA < depthB : a.parent < b.parent;
+            });
+        m_HierarchySorted = true;
+    }
+
+    std::unique_ptr<Registry> Registry::Clone(std::pmr::memory_resource* resource) const
+    {
+        auto clone = std::make_unique<Registry>(resource ? resource : m_Resource);
+        clone->CopyFrom(*this);
+        return clone;
+    }
+
+    void Registry::CopyFrom(const Registry& source)
+    {
+        AssertStructuralChangesAllowed();
+        m_EntityPool = source.m_EntityPool;
+        m_EntitySignatures = source.m_EntitySignatures;
+
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS; typeID++)
+        {
+            const std::unique_ptr<ComponentStorageBase>& from = source.m_ComponentStorages[typeID];
+            std::unique_ptr<ComponentStorageBase>& to = m_ComponentStorages[typeID];
+            if (from && to)
+                to->CopyFrom(*from);
+            else if (from)
+            {
+                to = from->Clone(this, &m_CurrentTick, m_Resource);
+                OnStorageCreated(typeID, *to);
+            }
+            else if (to)
+                to->Clear();
+        }
+
+        m_NameIndex = source.m_NameIndex;
+        m_NameSlots = source.m_NameSlots;
+        m_HierarchySorted = source.m_HierarchySorted;
+
+        for (GroupEntry& entry : m_Groups)
+        {
+            entry.group->Rebuild();
+        }
+
+        // Copied components keep source's ticks; never move this registry's tick backwards
+        Tick tick = std::max(GetCurrentTick(), source.GetCurrentTick());
+        m_CurrentTick.store(tick, std::memory_order_relaxed);
+    }
+
+    RegistryMemoryStats Registry::GetMemoryStats() const
+    {
+        RegistryMemoryStats stats;
+        stats.aliveEntities = m_EntityPool.GetAliveCount();
+        stats.peakEntities = m_EntityPool.GetIndexCount() - 1;
+        stats.freeListLength = m_EntityPool.GetFreeCount();
+        stats.entityBytes = m_EntityPool.GetMemoryBytes() + m_EntitySignatures.capacity() * sizeof(ComponentSignature) +
+            m_NameSlots.capacity() * sizeof(NameIndexSlot);
+
+        for (const std::unique_ptr<ComponentStorageBase>& storage : m_ComponentStorages)
+        {
+            if (storage)
+                stats.storages.push_back(storage->GetMemoryStats());
+        }
+        return stats;
+    }
+
+    void Registry::LogMemoryStats() const
+    {
+        RegistryMemoryStats stats = GetMemoryStats();
+
+        char line[256];
+        std::snprintf(line, sizeof(line), "Registry memory: %.2f MiB in %zu storages (%.2f MiB wasted), entities %zu alive / %zu peak / %zu free",
+            stats.GetTotalBytes() / (1024.0 * 1024.0), stats.storages.size(), stats.GetWastedBytes() / (1024.0 * 1024.0),
+            stats.aliveEntities, stats.peakEntities, stats.freeListLength);
+        NEXUS_CORE_INFO(line);
+
+        for (const StorageMemoryStats& storage : stats.storages)
+        {
+            std::snprintf(line, sizeof(line), "  %-32.*s %8zu / %8zu  %9.1f KiB  wasted %8.1f KiB  fragmentation %5.1f%%",
+                static_cast<int>(storage.typeName.size()), storage.typeName.data(), storage.count, storage.capacity,
+                storage.GetTotalBytes() / 1024.0, storage.wastedBytes / 1024.0, storage.fragmentation * 100.0);
+            NEXUS_CORE_INFO(line);
+        }
+    }
 }
@@ -0,0 +1,188 @@
+#include "Scene/ECS/RegistryHistory.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Nexus
+{
+    RegistryHistory::RegistryHistory(Registry& registry, size_t capacity)
+        : m_Registry(registry), m_Capacity(capacity), m_Base(registry.Clone()), m_LastPool(registry.m_EntityPool)
+    {
+        if (capacity == 0)
+            throw std::runtime_error("History capacity must be at least one frame");
+
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS; typeID++)
+        {
+            if (m_Registry.m_ComponentStorages[typeID])
+                AssureTrack(typeID);
+        }
+
+        // Everything stamped up to now is in the clone
+        m_LastTick = m_Registry.GetCurrentTick();
+        m_Registry.AdvanceTick();
+    }
+
+    RegistryHistory::~RegistryHistory()
+    {
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS; typeID++)
+        {
+            if (ComponentTrack* track = m_Tracks[typeID].get())
+            {
+                ComponentStorageBase& storage = *m_Registry.m_ComponentStorages[typeID];
+                storage.OnConstruct().Disconnect<&ComponentTrack::OnConstruct>(track);
+                storage.OnDestroy().Disconnect<&ComponentTrack::OnDestroy>(track);
+            }
+        }
+    }
+
+    bool RegistryHistory::AssureTrack(ComponentTypeID typeID)
+    {
+        if (m_Tracks[typeID])
+            return false;
+
+        m_Tracks[typeID] = std::make_unique<ComponentTrack>();
+        ComponentTrack* track = m_Tracks[typeID].get();
+        ComponentStorageBase& storage = *m_Registry.m_ComponentStorages[typeID];
+        storage.OnConstruct().Connect<&ComponentTrack::OnConstruct>(track);
+        storage.OnDestroy().Connect<&ComponentTrack::OnDestroy>(track);
+        return true;
+    }
+
+    void RegistryHistory::ClearTracks()
+    {
+        for (std::unique_ptr<ComponentTrack>& track : m_Tracks)
+        {
+            if (track)
+            {
+                track->added.clear();
+                track->removed.clear();
+            }
+        }
+    }
+
+    void RegistryHistory::Record()
+    {
+        Frame frame;
+
+        const EntityPool& pool = m_Registry.m_EntityPool;
+        if (!std::ranges::equal(pool.GetHandles(), m_LastPool.GetHandles()) ||
+            !std::ranges::equal(pool.GetFreeIndices(), m_LastPool.GetFreeIndices()))
+        {
+            m_LastPool = pool;
+            frame.pool = pool;
+        }
+
+        for (ComponentTypeID typeID = 0; typeID < MAX_COMPONENTS; typeID++)
+        {
+            const std::unique_ptr<ComponentStorageBase>& storage = m_Registry.m_ComponentStorages[typeID];
+            if (!storage)
+                continue;
+
+            // A storage created since the last Record was empty before, so all of it is new
+            Tick sinceTick = AssureTrack(typeID) ? 0 : m_LastTick;
+            ComponentTrack& track = *m_Tracks[typeID];
+
+            std::unique_ptr<ComponentDeltaBase> delta = storage->CaptureChanges(sinceTick, track.added);
+            delta->removed = std::move(track.removed);
+            track.added.clear();
+            track.removed.clear();
+            if (!delta->IsEmpty())
+                frame.deltas.push_back({ typeID, std::move(delta) });
+        }
+
+        if (m_Frames.size() == m_Capacity)
+        {
+            ApplyFrame(*m_Base, m_Frames.front());
+            m_Frames.pop_front();
+        }
+        m_Frames.push_back(std::move(frame));
+
+        m_LastTick = m_Registry.GetCurrentTick();
+        m_Registry.AdvanceTick();
+    }
+
+    void RegistryHistory::Rewind(size_t frames)
+    {
+        if (frames > m_Frames.size())
+            throw std::runtime_error("Cannot rewind past the oldest recorded frame");
+
+        m_Registry.CopyFrom(*m_Base);
+        for (const std::unique_ptr<ComponentStorageBase>& storage : m_Registry.m_ComponentStorages)
+        {
+            if (storage)
+                storage->MarkAllChanged();
+        }
+
+        m_Frames.erase(m_Frames.end() - static_cast<std::ptrdiff_t>(frames), m_Frames.end());
+        for (const Frame& frame : m_Frames)
+        {
+            ApplyFrame(m_Registry, frame);
+        }
+
+        // Replaying went through the storages' signals; none of it is a new change
+        ClearTracks();
+        m_LastPool = m_Registry.m_EntityPool;
+        m_LastTick = m_Registry.GetCurrentTick();
+        m_Registry.AdvanceTick();
+    }
+
+    void RegistryHistory::ApplyFrame(Registry& target, const Frame& frame)
+    {
+        // Removals refer to entities of the previous pool, so apply them before replacing it
+        for (const TypeDelta& entry : frame.deltas)
+        {
+            ComponentStorageBase* storage = target.m_ComponentStorages[entry.typeID].get();
+            if (!storage)
+                continue;
+
+            for (EntityID entity : entry.delta->removed)
+            {
+                if (target.m_EntityPool.IsAlive(entity) && storage->HasComponent(entity))
+                {
+                    storage->RemoveComponent(entity);
+                    target.m_EntitySignatures[GetEntityIndex(entity)].reset(entry.typeID);
+                }
+            }
+        }
+
+        if (frame.pool)
+        {
+            target.m_EntityPool = *frame.pool;
+            if (target.m_EntitySignatures.size() < target.m_EntityPool.GetIndexCount())
+                target.m_EntitySignatures.resize(target.m_EntityPool.GetIndexCount());
+        }
+
+        for (const TypeDelta& entry : frame.deltas)
+        {
+            std::unique_ptr<ComponentStorageBase>& storage = target.m_ComponentStorages[entry.typeID];
+            if (!storage)
+            {
+                storage = entry.delta->CreateStorage(&target, &target.m_CurrentTick, target.m_Resource);
+                target.OnStorageCreated(entry.typeID, *storage);
+            }
+
+            storage->ApplyChanges(*entry.delta);
+            for (EntityID entity : entry.delta->written)
+            {
+                target.m_EntitySignatures[GetEntityIndex(entity)].set(entry.typeID);
+            }
+        }
+
+        // Re-added entries are appended, maybe after their children
+        target.m_HierarchySorted = false;
+    }
+
+    size_t RegistryHistory::GetMemoryBytes() const
+    {
+        size_t bytes = m_Base->GetMemoryStats().GetTotalBytes() + m_LastPool.GetMemoryBytes();
+        for (const Frame& frame : m_Frames)
+        {
+            if (frame.pool)
+                bytes += frame.pool->GetMemoryBytes();
+            for (const TypeDelta& entry : frame.deltas)
+            {
+                bytes += entry.delta->GetMemoryBytes();
+            }
+        }
+        return bytes;
+    }
+}
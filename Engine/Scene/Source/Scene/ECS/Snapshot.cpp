@@ -0,0 +1,410 @@
+#include "Scene/ECS/Snapshot.h"
+#include "Scene/ECS/Components/Transform.h"
+#include "Scene/ECS/Components/MeshRenderer.h"
+#include "Scene/ECS/Components/Name.h"
+#include "Scene/ECS/Components/Light.h"
+#include "Scene/ECS/Components/CameraComponent.h"
+#include "Scene/ECS/Components/Tags.h"
+#include "Scene/ECS/Components/Relationship.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <fstream>
+
+namespace Nexus
+{
+    // Transform and MeshRenderer are raw blocks (mappable in place); MeshRenderer's paths are
+    // stored as indices into the snapshot's string table
+    void RemapStrings(MeshRenderer& meshRenderer, const SnapshotStrings& strings)
+    {
+        meshRenderer.meshPath = strings.Remap(meshRenderer.meshPath);
+        meshRenderer.materialPath = strings.Remap(meshRenderer.materialPath);
+    }
+
+    // Built-in component serializers
+    void Serialize(SnapshotWriter& writer, const Name& name)
+    {
+        writer.WriteString(name.GetString());
+    }
+
+    void Deserialize(SnapshotReader& reader, Name& name)
+    {
+        name.name = StringID(reader.ReadString());
+    }
+
+    void Serialize(SnapshotWriter& writer, const Tag& tag)
+    {
+        writer.WriteString(tag.GetString());
+    }
+
+    void Deserialize(SnapshotReader& reader, Tag& tag)
+    {
+        tag.tag = StringID(reader.ReadString());
+    }
+
+    RegistrySnapshot::RegistrySnapshot()
+    {
+        RegisterComponent<Transform>("Transform");
+        RegisterComponent<MeshRenderer>("MeshRenderer");
+        RegisterComponent<Name>("Name");
+        RegisterComponent<Tag>("Tag");
+        RegisterComponent<Light>("Light");
+        RegisterComponent<CameraComponent>("CameraComponent");
+        RegisterComponent<Static>("Static");
+        RegisterComponent<Selected>("Selected");
+        RegisterComponent<Hidden>("Hidden");
+        RegisterComponent<Relationship>("Relationship");
+    }
+
+    void RegistrySnapshot::AddEntry(ComponentEntry entry)
+    {
+        for (const ComponentEntry& existing : m_Entries)
+        {
+            if (existing.name == entry.name || existing.typeID == entry.typeID)
+                throw std::runtime_error("Component is already registered for snapshots: " + entry.name);
+        }
+        m_Entries.push_back(std::move(entry));
+    }
+
+    const RegistrySnapshot::ComponentEntry* RegistrySnapshot::FindEntry(const std::string& name) const
+    {
+        for (const ComponentEntry& entry : m_Entries)
+        {
+            if (entry.name == name)
+                return &entry;
+        }
+        return nullptr;
+    }
+
+    void RegistrySnapshot::Save(const Registry& registry, std::vector<uint8_t>& out) const
+    {
+        const std::pmr::vector<EntityID>& handles = registry.m_EntityPool.GetHandles();
+        const std::pmr::vector<EntityID>& freeIndices = registry.m_EntityPool.GetFreeIndices();
+
+        // Grow the buffer once for the fixed-size part of the snapshot
+        size_t estimate = 64 + (handles.size() + freeIndices.size()) * sizeof(EntityID);
+        for (const ComponentEntry& entry : m_Entries)
+        {
+            if (const ComponentStorageBase* storage = registry.m_ComponentStorages[entry.typeID].get())
+                estimate += 64 + entry.name.size() + storage->GetComponentCount() * (sizeof(EntityID) + entry.elementSize);
+        }
+
+        out.clear();
+        out.reserve(estimate);
+        SnapshotWriter writer(out);
+
+        writer.Write(MAGIC);
+        writer.Write(VERSION);
+
+        writer.Write(static_cast<uint64_t>(handles.size()));
+        writer.WriteBytes(handles.data(), handles.size() * sizeof(EntityID));
+        writer.Write(static_cast<uint64_t>(freeIndices.size()));
+        writer.WriteBytes(freeIndices.data(), freeIndices.size() * sizeof(EntityID));
+
+        // Only the strings that raw blocks reference; Name and Tag store their text inline
+        SnapshotStrings strings;
+        strings.m_Saving = true;
+        strings.m_IDs.push_back(StringID());
+        for (const ComponentEntry& entry : m_Entries)
+        {
+            const ComponentStorageBase* storage = registry.m_ComponentStorages[entry.typeID].get();
+            if (storage && entry.collectStrings)
+                entry.collectStrings(*storage, strings);
+        }
+        WriteStrings(writer, strings);
+
+        uint32_t blockCount = 0;
+        for (const ComponentEntry& entry : m_Entries)
+        {
+            const ComponentStorageBase* storage = registry.m_ComponentStorages[entry.typeID].get();
+            if (storage && storage->GetComponentCount() > 0)
+                blockCount++;
+        }
+        writer.Write(blockCount);
+
+        for (const ComponentEntry& entry : m_Entries)
+        {
+            const ComponentStorageBase* storage = registry.m_ComponentStorages[entry.typeID].get();
+            if (!storage || storage->GetComponentCount() == 0)
+                continue;
+
+            size_t block = writer.BeginBlock();
+            writer.WriteString(entry.name);
+            writer.Write(entry.encoding);
+            writer.Write(entry.elementSize);
+            writer.Write(static_cast<uint64_t>(storage->GetComponentCount()));
+            entry.save(*storage, writer, strings);
+            writer.EndBlock(block);
+        }
+    }
+
+    std::vector<uint8_t> RegistrySnapshot::Save(const Registry& registry) const
+    {
+        std::vector<uint8_t> out;
+        Save(registry, out);
+        return out;
+    }
+
+    void RegistrySnapshot::Load(Registry& registry, std::span<const uint8_t> data, std::span<const std::string> skip) const
+    {
+        registry.AssertStructuralChangesAllowed();
+        if (registry.GetEntityCount() != 0)
+            throw std::runtime_error("Snapshots can only be loaded into a registry without entities");
+
+        SnapshotReader reader(data, &registry);
+        ReadHeader(reader);
+
+        // Entity pool
+        uint64_t handleCount = reader.Read<uint64_t>();
+        reader.RequireElements(handleCount, sizeof(EntityID));
+        std::vector<EntityID> handles(handleCount);
+        reader.ReadBytes(handles.data(), handleCount * sizeof(EntityID));
+
+        uint64_t freeCount = reader.Read<uint64_t>();
+        reader.RequireElements(freeCount, sizeof(EntityID));
+        std::vector<EntityID> freeIndices(freeCount);
+        reader.ReadBytes(freeIndices.data(), freeCount * sizeof(EntityID));
+
+        registry.m_EntityPool.Restore(handles, freeIndices);
+        registry.m_EntitySignatures.assign(registry.m_EntityPool.GetIndexCount(), ComponentSignature());
+        registry.m_HierarchySorted = false;
+
+        SnapshotStrings strings = ReadStrings(reader);
+
+        // Component blocks
+        uint32_t blockCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < blockCount; i++)
+        {
+            uint64_t blockSize = reader.Read<uint64_t>();
+            size_t blockEnd = reader.GetOffset() + blockSize;
+            reader.RequireElements(blockSize, 1);
+
+            std::string name = reader.ReadString();
+            Encoding encoding = reader.Read<Encoding>();
+            uint32_t elementSize = reader.Read<uint32_t>();
+            uint64_t count = reader.Read<uint64_t>();
+
+            if (std::find(skip.begin(), skip.end(), name) != skip.end())
+            {
+                reader.Skip(blockEnd - reader.GetOffset());
+                continue;
+            }
+
+            const ComponentEntry* entry = FindEntry(name);
+            if (!entry)
+            {
+                NEXUS_CORE_INFO("Snapshot leaves unregistered component '" + name + "' unloaded");
+                reader.Skip(blockEnd - reader.GetOffset());
+                continue;
+            }
+
+            if (encoding != entry->encoding || elementSize != entry->elementSize)
+                throw std::runtime_error("Snapshot layout of component '" + name + "' does not match this build");
+
+            entry->load(registry, reader, count, strings);
+            if (reader.GetOffset() != blockEnd)
+                throw std::runtime_error("Snapshot block of component '" + name + "' has an unexpected size");
+        }
+
+        ValidateHierarchy(registry);
+    }
+
+    void RegistrySnapshot::ValidateHierarchy(const Registry& registry)
+    {
+        // Relationship is a raw block, so its links are whatever the file says. The hierarchy
+        // code follows them unchecked; reject anything Registry::SetParent could not produce.
+        const ComponentStorage<Relationship>* relationships = registry.GetComponentStorage<Relationship>();
+        if (!relationships)
+            return;
+
+        const std::pmr::vector<EntityID>& entities = relationships->GetEntities();
+        const std::pmr::vector<Relationship>& links = relationships->GetComponents();
+        const size_t count = entities.size();
+        auto linked = [&](EntityID entity)
+        {
+            ComponentIndex index = registry.m_EntityPool.IsAlive(entity) ? relationships->GetIndex(entity) : INVALID_COMPONENT_INDEX;
+            if (index == INVALID_COMPONENT_INDEX)
+                throw std::runtime_error("Snapshot hierarchy links an entity without a Relationship");
+            return &links[index];
+        };
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const EntityID entity = entities[i];
+            const Relationship& relationship = links[i];
+
+            if (relationship.parent != NULL_ENTITY)
+            {
+                const Relationship* parent = linked(relationship.parent);
+                if (relationship.prevSibling == NULL_ENTITY && parent->firstChild != entity)
+                    throw std::runtime_error("Snapshot hierarchy is inconsistent");
+            }
+            else if (relationship.nextSibling != NULL_ENTITY || relationship.prevSibling != NULL_ENTITY)
+            {
+                throw std::runtime_error("Snapshot hierarchy is inconsistent");
+            }
+
+            if (relationship.nextSibling != NULL_ENTITY)
+            {
+                const Relationship* next = linked(relationship.nextSibling);
+                if (next->prevSibling != entity || next->parent != relationship.parent)
+                    throw std::runtime_error("Snapshot hierarchy is inconsistent");
+            }
+            if (relationship.prevSibling != NULL_ENTITY)
+            {
+                const Relationship* prev = linked(relationship.prevSibling);
+                if (prev->nextSibling != entity || prev->parent != relationship.parent)
+                    throw std::runtime_error("Snapshot hierarchy is inconsistent");
+            }
+
+            // The child list must end (each link was checked to point back) and match the count
+            uint32_t children = 0;
+            for (EntityID child = relationship.firstChild; child != NULL_ENTITY; child = linked(child)->nextSibling)
+            {
+                if (linked(child)->parent != entity || ++children > count)
+                    throw std::runtime_error("Snapshot hierarchy is inconsistent");
+            }
+            if (children != relationship.childCount)
+                throw std::runtime_error("Snapshot hierarchy is inconsistent");
+        }
+
+        // No entity may be its own ancestor: climb each chain once, up to a node known to be fine
+        std::vector<uint8_t> state(count, 0);   // 0 unvisited, 1 on the current chain, 2 checked
+        std::vector<size_t> chain;
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t node = i;
+            while (state[node] == 0)
+            {
+                state[node] = 1;
+                chain.push_back(node);
+                if (links[node].parent == NULL_ENTITY)
+                    break;
+                node = relationships->GetIndex(links[node].parent);
+            }
+            if (state[node] == 1 && links[node].parent != NULL_ENTITY)
+                throw std::runtime_error("Snapshot hierarchy contains a cycle");
+
+            for (size_t visited : chain)
+            {
+                state[visited] = 2;
+            }
+            chain.clear();
+        }
+    }
+
+    void RegistrySnapshot::ReadHeader(SnapshotReader& reader)
+    {
+        if (reader.Read<uint32_t>() != MAGIC)
+            throw std::runtime_error("Not a registry snapshot");
+        if (reader.Read<uint32_t>() != VERSION)
+            throw std::runtime_error("Unsupported registry snapshot version");
+    }
+
+    void RegistrySnapshot::WriteStrings(SnapshotWriter& writer, const SnapshotStrings& strings)
+    {
+        // In snapshot order; index 0 is the empty string and is not stored
+        writer.Write(static_cast<uint32_t>(strings.m_IDs.size()));
+        for (size_t index = 1; index < strings.m_IDs.size(); index++)
+        {
+            writer.WriteString(strings.m_IDs[index].GetString());
+        }
+    }
+
+    SnapshotStrings RegistrySnapshot::ReadStrings(SnapshotReader& reader)
+    {
+        // Each string has at least its size field
+        uint32_t count = reader.Read<uint32_t>();
+        if (count == 0)
+            throw std::runtime_error("Snapshot string table is malformed");
+        reader.RequireElements(count - 1, sizeof(uint32_t));
+
+        SnapshotStrings strings;
+        strings.m_IDs.reserve(count);
+        strings.m_IDs.push_back(StringID());
+        for (uint32_t index = 1; index < count; index++)
+        {
+            StringID id(reader.ReadString());
+            strings.m_Identity = strings.m_Identity && id.GetIndex() == index;
+            strings.m_IDs.push_back(id);
+        }
+        return strings;
+    }
+
+    std::vector<RegistrySnapshot::BlockInfo> RegistrySnapshot::ReadBlocks(std::span<const uint8_t> data, SnapshotStrings& strings)
+    {
+        SnapshotReader reader(data, nullptr);
+        ReadHeader(reader);
+
+        // Skip the entity pool
+        uint64_t handleCount = reader.Read<uint64_t>();
+        reader.RequireElements(handleCount, sizeof(EntityID));
+        reader.Skip(handleCount * sizeof(EntityID));
+        uint64_t freeCount = reader.Read<uint64_t>();
+        reader.RequireElements(freeCount, sizeof(EntityID));
+        reader.Skip(freeCount * sizeof(EntityID));
+        strings = ReadStrings(reader);
+
+        std::vector<BlockInfo> blocks;
+        uint32_t blockCount = reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < blockCount; i++)
+        {
+            uint64_t blockSize = reader.Read<uint64_t>();
+            reader.RequireElements(blockSize, 1);
+            size_t blockEnd = reader.GetOffset() + blockSize;
+
+            BlockInfo block;
+            block.name = reader.ReadString();
+            block.raw = reader.Read<Encoding>() == Encoding::Raw;
+            block.elementSize = reader.Read<uint32_t>();
+            block.count = reader.Read<uint64_t>();
+
+            reader.Align(CACHE_LINE_SIZE);
+            block.entitiesOffset = reader.GetOffset();
+            reader.RequireElements(block.count, sizeof(EntityID));
+            reader.Skip(block.count * sizeof(EntityID));
+
+            block.componentsOffset = 0;
+            if (block.raw)
+            {
+                reader.Align(CACHE_LINE_SIZE);
+                block.componentsOffset = reader.GetOffset();
+                reader.RequireElements(block.count, block.elementSize);
+                reader.Skip(block.count * block.elementSize);
+            }
+
+            if (reader.GetOffset() > blockEnd)
+                throw std::runtime_error("Snapshot block of component '" + block.name + "' has an unexpected size");
+            reader.Skip(blockEnd - reader.GetOffset());
+            blocks.push_back(std::move(block));
+        }
+        return blocks;
+    }
+
+    void RegistrySnapshot::SaveToFile(const Registry& registry, const std::string& path) const
+    {
+        std::vector<uint8_t> data;
+        Save(registry, data);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("Failed to open snapshot file for writing: " + path);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file)
+            throw std::runtime_error("Failed to write snapshot file: " + path);
+    }
+
+    void RegistrySnapshot::LoadFromFile(Registry& registry, const std::string& path) const
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error("Failed to open snapshot file: " + path);
+
+        std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file)
+            throw std::runtime_error("Failed to read snapshot file: " + path);
+
+        Load(registry, data);
+    }
+}
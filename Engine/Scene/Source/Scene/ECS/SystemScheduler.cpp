@@ -0,0 +1,122 @@
+#include "Scene/ECS/SystemScheduler.h"
+#include "Scene/ECS/Registry.h"
+#include "Core/Logger.h"
+#include <cstdio>
+#include <utility>
+
+namespace Nexus
+{
+    uint32_t SystemScheduler::AddSystem(const std::string& name, const ComponentAccess& access, SystemFunction function)
+    {
+        uint32_t index = static_cast<uint32_t>(m_Systems.size());
+
+        System system{ name, access, std::move(function), {}, {}, 0 };
+
+        // Every earlier system with conflicting access must finish first
+        for (uint32_t other = 0; other < index; other++)
+        {
+            if (access.ConflictsWith(m_Systems[other].access))
+            {
+                system.dependencies.push_back(other);
+                m_Systems[other].dependents.push_back(index);
+                NEXUS_CORE_INFO("System '" + name + "' conflicts with '" + m_Systems[other].name + "', runs after it");
+            }
+        }
+
+        m_Systems.push_back(std::move(system));
+        m_PendingDependencies = std::make_unique<std::atomic<uint32_t>[]>(m_Systems.size());
+        m_Timeline.push_back({ index, 0, 0.0, 0.0 });
+        return index;
+    }
+
+    void SystemScheduler::Run(Registry& registry, JobSystem& jobs)
+    {
+        JobCounter frameCounter;
+        m_Registry = &registry;
+        m_Jobs = &jobs;
+        m_FrameCounter = &frameCounter;
+        m_FrameStart = std::chrono::steady_clock::now();
+        m_Failed.store(false, std::memory_order_relaxed);
+        m_Exception = nullptr;
+
+        for (size_t i = 0; i < m_Systems.size(); i++)
+        {
+            m_PendingDependencies[i].store(static_cast<uint32_t>(m_Systems[i].dependencies.size()), std::memory_order_relaxed);
+        }
+
+        // Start the roots; the rest are scheduled as their dependencies finish
+        for (uint32_t i = 0; i < m_Systems.size(); i++)
+        {
+            if (m_Systems[i].dependencies.empty())
+                Schedule(i);
+        }
+
+        jobs.Wait(frameCounter);
+        m_FrameCounter = nullptr;
+
+        // Changes made between frames get a tick newer than every system run of this frame
+        registry.AdvanceTick();
+
+        // Thrown on the calling thread; letting it escape a worker would terminate the process
+        if (m_Exception)
+            std::rethrow_exception(std::exchange(m_Exception, nullptr));
+    }
+
+    void SystemScheduler::Schedule(uint32_t index)
+    {
+        SystemScheduler* scheduler = this;
+        m_Jobs->Run([scheduler, index]() { scheduler->Execute(index); }, m_FrameCounter);
+    }
+
+    void SystemScheduler::Execute(uint32_t index)
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        System& system = m_Systems[index];
+        SystemTimelineEntry& entry = m_Timeline[index];
+        entry.systemIndex = index;
+        entry.threadIndex = m_Jobs->GetCurrentThreadIndex();
+        entry.startMilliseconds = Milliseconds(std::chrono::steady_clock::now() - m_FrameStart).count();
+
+        // After a failure the rest of the frame is skipped, but dependents are still released
+        // so the frame counter reaches zero
+        if (!m_Failed.load(std::memory_order_acquire))
+        {
+            try
+            {
+                Tick runTick = m_Registry->AdvanceTick();
+                SystemContext context{ *m_Registry, *m_Jobs, system.lastRunTick };
+                system.function(context);
+                system.lastRunTick = runTick;
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_ExceptionMutex);
+                if (!m_Exception)
+                    m_Exception = std::current_exception();
+                m_Failed.store(true, std::memory_order_release);
+            }
+        }
+
+        entry.endMilliseconds = Milliseconds(std::chrono::steady_clock::now() - m_FrameStart).count();
+
+        // Release dependents whose last dependency this was
+        for (uint32_t dependent : system.dependents)
+        {
+            if (m_PendingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                Schedule(dependent);
+        }
+    }
+
+    void SystemScheduler::LogTimeline() const
+    {
+        for (const SystemTimelineEntry& entry : m_Timeline)
+        {
+            char line[256];
+            std::snprintf(line, sizeof(line), "%-32s thread %2u  %8.3f - %8.3f ms",
+                m_Systems[entry.systemIndex].name.c_str(), entry.threadIndex,
+                entry.startMilliseconds, entry.endMilliseconds);
+            NEXUS_CORE_INFO(line);
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include "Scene/ECS/Registry.h"
 #include "Scene/ECS/Components/Transform.h"
 #include "Scene/ECS/Components/MeshRenderer.h"
+#include "Scene/ECS/Components/Tags.h"
 #include "Renderer/Camera.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Texture.h"
@@ -134,35 +135,36 @@ namespace Nexus
         // Simple camera setup - look at cube from distance
         glTranslatef(0.0f, 0.0f, -5.0f);
 
-        // Render all ECS entities with Transform and MeshRenderer
-        auto transformView = registry.GetView<Transform>();
+        // Render all ECS entities with Transform and MeshRenderer; the owning group keeps both
+        // storages packed in the same order, so this is a linear walk with no lookups
+        const auto& renderables = registry.Group<Transform, MeshRenderer>();
         int entitiesRendered = 0;
 
-        for (auto [entity, transform] : transformView)
+        renderables.ForEach([&](Entity entity, const Transform& transform, const MeshRenderer& meshRenderer)
         {
-            if (entity.HasComponent<MeshRenderer>())
-            {
-                glPushMatrix();
+            if (registry.HasComponent<Hidden>(entity))
+                return;
 
-                // Apply ECS transform - simplified for now
-                Vector3 pos = transform.position;
-                Vector3 scale = transform.scale;
+            glPushMatrix();
 
-                glTranslatef(pos.x, pos.y, pos.z);
-                glScalef(scale.x, scale.y, scale.z);
+            // Apply ECS transform - simplified for now
+            Vector3 pos = transform.position;
+            Vector3 scale = transform.scale;
 
-                // Add simple rotation using static time-based rotation
-                static float rotationAngle = 0.0f;
-                rotationAngle += 1.0f; // Increment each frame
-                glRotatef(rotationAngle, 0.0f, 1.0f, 0.0f); // Rotate around Y axis
+            glTranslatef(pos.x, pos.y, pos.z);
+            glScalef(scale.x, scale.y, scale.z);
 
-                // Draw single checkered cube
-                DrawCheckeredCube();
+            // Add simple rotation using static time-based rotation
+            static float rotationAngle = 0.0f;
+            rotationAngle += 1.0f; // Increment each frame
+            glRotatef(rotationAngle, 0.0f, 1.0f, 0.0f); // Rotate around Y axis
 
-                glPopMatrix();
-                entitiesRendered++;
-            }
-        }
+            // Draw single checkered cube
+            DrawCheckeredCube();
+
+            glPopMatrix();
+            entitiesRendered++;
+        });
 
         // Log occasionally with minimal info
         static int frameCount = 0;
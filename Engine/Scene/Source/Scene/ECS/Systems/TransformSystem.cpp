@@ -0,0 +1,209 @@
+#include "Scene/ECS/Systems/TransformSystem.h"
+
+namespace Nexus
+{
+    // Nodes per job; a world matrix is one 4x4 multiply, so batches must be large to pay off
+    static constexpr size_t TRANSFORM_BATCH_SIZE = 2048;
+
+    template<typename Func>
+    static void ForEachBatch(JobSystem* jobs, size_t count, const Func& func)
+    {
+        if (jobs)
+            jobs->ParallelFor(count, TRANSFORM_BATCH_SIZE, func);
+        else if (count > 0)
+            func(0, count);
+    }
+
+    void TransformSystem::Update(Registry& registry)
+    {
+        Update(registry, nullptr);
+    }
+
+    void TransformSystem::Update(Registry& registry, JobSystem& jobs)
+    {
+        Update(registry, &jobs);
+    }
+
+    void TransformSystem::Update(Registry& registry, JobSystem* jobs)
+    {
+        m_UpdatedCount.store(0, std::memory_order_relaxed);
+
+        ComponentStorage<Transform>* transforms = registry.GetComponentStorage<Transform>();
+        if (!transforms)
+            return;
+
+        // Parents before children, and hierarchy transforms in the same order at the front.
+        // A group-owned storage must keep the group's order, so it is not sorted.
+        const ComponentStorage<Relationship>& relationships = *registry.GetOrCreateComponentStorage<Relationship>();
+        bool sortRelationships = !relationships.GetGroup();
+        m_HierarchyFirst = sortRelationships && !transforms->GetGroup();
+        if (m_HierarchyFirst)
+            registry.SortHierarchy<Transform>();
+        else if (sortRelationships)
+            registry.SortHierarchy<>();
+
+        m_WorldParents.resize(registry.m_EntityPool.GetIndexCount(), NULL_ENTITY);
+        BuildLevels(relationships, *transforms);
+
+        // A level only reads world matrices of the level above, so its nodes are independent
+        for (size_t level = 0; level + 1 < m_LevelStarts.size(); level++)
+        {
+            const uint32_t* nodes = m_Nodes.data() + m_LevelStarts[level];
+            ForEachBatch(jobs, m_LevelStarts[level + 1] - m_LevelStarts[level],
+                [&](size_t begin, size_t end) { UpdateNodes(*transforms, nodes + begin, end - begin); });
+        }
+
+        // Transforms outside the hierarchy; with a sorted storage they are the ones after it
+        size_t first = m_HierarchyFirst ? m_HierarchyTransforms : 0;
+        ForEachBatch(jobs, transforms->GetComponentCount() - first,
+            [&](size_t begin, size_t end) { UpdateRoots(*transforms, relationships, first + begin, first + end); });
+    }
+
+    void TransformSystem::BuildLevels(const ComponentStorage<Relationship>& relationships, ComponentStorage<Transform>& transforms)
+    {
+        const std::pmr::vector<EntityID>& entities = relationships.GetEntities();
+        const std::pmr::vector<Relationship>& links = relationships.GetComponents();
+        const size_t count = entities.size();
+
+        m_Parents.resize(count);
+        m_Transforms.resize(count);
+        m_Updated.assign(count, 0);
+        m_LevelStarts.assign(1, 0);
+        m_HierarchyTransforms = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            EntityID parent = links[i].parent;
+            m_Parents[i] = parent == NULL_ENTITY ? NO_INDEX : static_cast<uint32_t>(relationships.GetIndex(parent));
+
+            ComponentIndex transform = transforms.GetIndex(entities[i]);
+            m_Transforms[i] = transform == INVALID_COMPONENT_INDEX ? NO_INDEX : static_cast<uint32_t>(transform);
+            m_HierarchyTransforms += transform != INVALID_COMPONENT_INDEX;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t transform = m_Transforms[i];
+            if (transform == NO_INDEX)
+                continue;
+
+            // Reparented (or the parent gained or lost its Transform) since the last Update
+            uint32_t parent = m_Parents[i];
+            EntityID worldParent = parent != NO_INDEX && m_Transforms[parent] != NO_INDEX ? links[i].parent : NULL_ENTITY;
+            EntityID& lastParent = m_WorldParents[GetEntityIndex(entities[i])];
+            if (lastParent != worldParent)
+            {
+                lastParent = worldParent;
+                transforms.GetComponents()[transform].isWorldDirty = true;
+            }
+        }
+
+        AssignDepths();
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t depth = m_Depths[i];
+            if (depth + 2 > m_LevelStarts.size())
+                m_LevelStarts.resize(depth + 2, 0);
+            m_LevelStarts[depth + 1]++;
+        }
+
+        // Counting sort by depth; each level keeps storage order for linear access
+        for (size_t level = 1; level < m_LevelStarts.size(); level++)
+        {
+            m_LevelStarts[level] += m_LevelStarts[level - 1];
+        }
+
+        m_Nodes.resize(count);
+        std::vector<size_t> cursors(m_LevelStarts.begin(), m_LevelStarts.end() - 1);
+        for (size_t i = 0; i < count; i++)
+        {
+            m_Nodes[cursors[m_Depths[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    void TransformSystem::AssignDepths()
+    {
+        const size_t count = m_Parents.size();
+        m_Depths.assign(count, NO_INDEX);
+
+        // In a sorted storage the parent's depth is always known, so this is one step per
+        // node; otherwise each chain is climbed once up to the first node with a known depth
+        for (size_t i = 0; i < count; i++)
+        {
+            if (m_Depths[i] != NO_INDEX)
+                continue;
+
+            uint32_t steps = 0;
+            uint32_t node = static_cast<uint32_t>(i);
+            while (node != NO_INDEX && m_Depths[node] == NO_INDEX)
+            {
+                node = m_Parents[node];
+                steps++;
+            }
+
+            uint32_t depth = node == NO_INDEX ? steps - 1 : m_Depths[node] + steps;
+            for (node = static_cast<uint32_t>(i); node != NO_INDEX && m_Depths[node] == NO_INDEX; node = m_Parents[node])
+            {
+                m_Depths[node] = depth--;
+            }
+        }
+    }
+
+    void TransformSystem::UpdateNodes(ComponentStorage<Transform>& transforms, const uint32_t* nodes, size_t count)
+    {
+        Transform* data = transforms.GetComponents().data();
+        size_t updated = 0;
+
+        for (size_t n = 0; n < count; n++)
+        {
+            uint32_t node = nodes[n];
+            uint32_t index = m_Transforms[node];
+            if (index == NO_INDEX)
+                continue;
+
+            uint32_t parent = m_Parents[node];
+            bool parentUpdated = parent != NO_INDEX && m_Updated[parent];
+            Transform& transform = data[index];
+            if (!transform.isWorldDirty && !parentUpdated)
+                continue;
+
+            uint32_t parentIndex = parent == NO_INDEX ? NO_INDEX : m_Transforms[parent];
+            const Matrix4& local = transform.GetLocalMatrix();
+            transform.worldMatrix = parentIndex == NO_INDEX ? local : data[parentIndex].worldMatrix * local;
+            transform.isWorldDirty = false;
+            transforms.MarkChangedRange(index, index + 1);
+            m_Updated[node] = 1;
+            updated++;
+        }
+
+        m_UpdatedCount.fetch_add(updated, std::memory_order_relaxed);
+    }
+
+    void TransformSystem::UpdateRoots(ComponentStorage<Transform>& transforms, const ComponentStorage<Relationship>& relationships,
+        size_t begin, size_t end)
+    {
+        Transform* data = transforms.GetComponents().data();
+        size_t updated = 0;
+
+        for (size_t index = begin; index < end; index++)
+        {
+            EntityID entity = transforms.GetEntities()[index];
+            if (!m_HierarchyFirst && relationships.HasComponent(entity))
+                continue;
+
+            // Its Relationship was removed since the last Update
+            EntityID& lastParent = m_WorldParents[GetEntityIndex(entity)];
+            Transform& transform = data[index];
+            if (!transform.isWorldDirty && lastParent == NULL_ENTITY)
+                continue;
+
+            lastParent = NULL_ENTITY;
+            transform.worldMatrix = transform.GetLocalMatrix();
+            transform.isWorldDirty = false;
+            transforms.MarkChangedRange(index, index + 1);
+            updated++;
+        }
+
+        m_UpdatedCount.fetch_add(updated, std::memory_order_relaxed);
+    }
+}
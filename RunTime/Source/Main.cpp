@@ -1,13 +1,18 @@
 #include "Core/Logger.h"
 #include "Core/Window.h"
+#include "Core/JobSystem.h"
 #include "Renderer/Camera.h"
 #include "Scene/ECS/Registry.h"
+#include "Scene/ECS/EntityCommandBuffer.h"
+#include "Scene/ECS/Prefab.h"
+#include "Scene/ECS/SystemScheduler.h"
 #include "Scene/ECS/Components/Transform.h"
 #include "Scene/ECS/Components/Name.h"
 #include "Scene/ECS/Components/CameraComponent.h"
 #include "Scene/ECS/Components/Light.h"
 #include "Scene/ECS/Components/MeshRenderer.h"
 #include "Scene/ECS/Systems/RenderSystem.h"
+#include "Scene/ECS/Systems/TransformSystem.h"
 #include "Input/InputManager.h"
 #include <windows.h>
 #include <GL/gl.h>
@@ -67,19 +72,22 @@ void ComprehensiveECSTest()
     NEXUS_CORE_INFO("Camera has MeshRenderer: " + std::string(cameraEntity.HasComponent<Nexus::MeshRenderer>() ? "YES" : "NO"));
     NEXUS_CORE_INFO("Orphan has Transform: " + std::string(orphanEntity.HasComponent<Nexus::Transform>() ? "YES" : "NO"));
 
-    // Test 6: Multi-component logic (manual for now)
+    // Test 6: Multi-component views
     int renderableEntities = 0;
-    for (auto [entity, transform] : transformView)
+    for (auto [entity, transform, meshRenderer] : registry.View<Nexus::Transform, Nexus::MeshRenderer>())
     {
-        if (entity.HasComponent<Nexus::MeshRenderer>())
-        {
-            renderableEntities++;
-            auto& meshRenderer = entity.GetComponent<Nexus::MeshRenderer>();
-            NEXUS_CORE_INFO("Renderable entity: " + meshRenderer.ToString());
-        }
+        renderableEntities++;
+        NEXUS_CORE_INFO("Renderable entity: " + meshRenderer.ToString());
     }
     NEXUS_CORE_INFO("Found " + std::to_string(renderableEntities) + " renderable entities (should be 1)");
 
+    int unlitEntities = 0;
+    for (auto [entity, transform] : registry.View<Nexus::Transform>(Nexus::Exclude<Nexus::Light>))
+    {
+        unlitEntities++;
+    }
+    NEXUS_CORE_INFO("Found " + std::to_string(unlitEntities) + " Transform entities without Light (should be 2)");
+
     // Test 7: Component removal
     cubeEntity.RemoveComponent<Nexus::Name>();
     NEXUS_CORE_INFO("Removed Name component from cube");
@@ -90,11 +98,12 @@ void ComprehensiveECSTest()
     registry.DestroyEntity(orphanEntity);
     NEXUS_CORE_INFO("Destroyed orphan entity with ID: " + std::to_string(oldOrphanID));
 
-    // Create new entity - should reuse the ID
+    // Create new entity - should reuse the index with a new generation
     auto newEntity = registry.CreateEntity();
     auto newEntityID = newEntity.GetID();
     NEXUS_CORE_INFO("Created new entity with ID: " + std::to_string(newEntityID));
-    NEXUS_CORE_INFO("ID was reused: " + std::string(newEntityID == oldOrphanID ? "YES" : "NO"));
+    NEXUS_CORE_INFO("Index was reused: " + std::string(Nexus::GetEntityIndex(newEntityID) == Nexus::GetEntityIndex(oldOrphanID) ? "YES" : "NO"));
+    NEXUS_CORE_INFO("Stale handle still valid: " + std::string(registry.IsValidEntity(orphanEntity) ? "YES" : "NO") + " (should be NO)");
 
     // Test 9: Verify destroyed entity doesn't appear in queries
     int finalTransformCount = 0;
@@ -104,6 +113,41 @@ void ComprehensiveECSTest()
     }
     NEXUS_CORE_INFO("Transform entities after destruction: " + std::to_string(finalTransformCount) + " (should still be 3)");
 
+    // Test 10: Deferred structural changes while iterating
+    Nexus::EntityCommandBuffer commands;
+    for (auto [entity, transform] : registry.View<Nexus::Transform>(Nexus::Exclude<Nexus::MeshRenderer>))
+    {
+        commands.AddComponent<Nexus::MeshRenderer>(entity, "marker.obj", "default.mat");
+    }
+    auto spawned = commands.CreateEntity();
+    commands.AddComponent<Nexus::Transform>(spawned, Nexus::Vector3(0, 0, -1));
+    commands.Playback(registry);
+
+    int deferredRenderables = 0;
+    for (auto [entity, transform, meshRenderer] : registry.View<Nexus::Transform, Nexus::MeshRenderer>())
+    {
+        deferredRenderables++;
+    }
+    NEXUS_CORE_INFO("Renderable entities after command buffer playback: " + std::to_string(deferredRenderables) + " (should be 3)");
+
+    // Test 11: Hierarchy links
+    registry.SetParent(lightEntity, cubeEntity);
+    registry.SetParent(cameraEntity, cubeEntity);
+    int cubeChildren = 0;
+    registry.ForEachChild(cubeEntity, [&](Nexus::Entity) { cubeChildren++; });
+    NEXUS_CORE_INFO("Cube children: " + std::to_string(cubeChildren) + " (should be 2)");
+    registry.SetParent(cameraEntity, Nexus::Entity());
+    NEXUS_CORE_INFO("Camera is a root again: " + std::string(registry.GetParent(cameraEntity).IsValid() ? "NO" : "YES"));
+
+    // Test 12: World matrices follow the hierarchy
+    Nexus::TransformSystem transformSystem;
+    transformSystem.Update(registry);
+    float lightWorldX = lightEntity.GetComponent<Nexus::Transform>().GetWorldMatrix()[12];
+    float expectedX = cubeEntity.GetComponent<Nexus::Transform>().position.x + 2.0f;
+    NEXUS_CORE_INFO("Light world X: " + std::to_string(lightWorldX) + " (should be " + std::to_string(expectedX) + ")");
+    transformSystem.Update(registry);
+    NEXUS_CORE_INFO("Transforms updated with nothing dirty: " + std::to_string(transformSystem.GetUpdatedCount()) + " (should be 0)");
+
     NEXUS_CORE_INFO("=== ECS Test Complete ===");
 }
 
@@ -149,13 +193,29 @@ void TestECSSystem()
         if (entity.HasComponent<Nexus::Name>())
         {
             auto& name = entity.GetComponent<Nexus::Name>();
-            NEXUS_CORE_INFO("Entity: " + name.name + " at position: " + transform.position.ToString());
+            NEXUS_CORE_INFO("Entity: " + name.GetString() + " at position: " + transform.position.ToString());
         }
         transformCount++;
     }
 
     NEXUS_CORE_INFO("Found " + std::to_string(transformCount) + " entities with Transform components");
 
+    // Lookup by name goes through the registry's name index
+    Nexus::Entity foundLight = registry.FindEntityByName("Main Light");
+    NEXUS_CORE_INFO("Found 'Main Light': " + std::string(foundLight.IsValid() ? "YES" : "NO"));
+
+    // Spawn a batch of lamps from a prefab. They own their Light: a Shared<Light> is a
+    // different component type, and lighting queries View<Light>
+    Nexus::Prefab lamp;
+    lamp.Add<Nexus::Transform>(Nexus::Vector3(0, 3, 0))
+        .Add<Nexus::Name>("Lamp")
+        .Add<Nexus::Light>(Nexus::Light::CreatePoint(6.0f));
+    std::vector<Nexus::Entity> lamps(8);
+    lamp.Instantiate(registry, lamps.size(), lamps);
+    NEXUS_CORE_INFO("Spawned " + std::to_string(registry.FindEntitiesByName(Nexus::StringID("Lamp")).size()) + " lamps from a prefab");
+    NEXUS_CORE_INFO("Lights after spawning lamps: " + std::to_string(registry.GetEntitiesWith<Nexus::Light>().size()) + " (should be 9)");
+    registry.DestroyEntities(lamps);
+
     // Test entity management
     auto tempEntity = registry.CreateEntity();
     tempEntity.AddComponent<Nexus::Name>("Temporary");
@@ -196,24 +256,62 @@ int main()
     // Create a cube entity for rendering
     auto cube = renderRegistry.CreateEntity();
     cube.AddComponent<Nexus::Name>("Rendered Cube");
-    auto& cubeTransform = cube.AddComponent<Nexus::Transform>();
-    cubeTransform.SetPosition(Nexus::Vector3(0, 0, 0));
+    cube.AddComponent<Nexus::Transform>().SetPosition(Nexus::Vector3(0, 0, 0));
     cube.AddComponent<Nexus::MeshRenderer>("cube.obj", "default.mat");
 
+    // Unrendered child, so world matrix propagation has a hierarchy to walk
+    auto satellite = renderRegistry.CreateEntity();
+    satellite.AddComponent<Nexus::Transform>().SetPosition(Nexus::Vector3(2, 0, 0));
+    renderRegistry.SetParent(satellite, cube);
+
+    // Update systems run on the job system; rendering stays on the main (GL) thread
+    Nexus::JobSystem jobSystem;
+    Nexus::SystemScheduler scheduler;
+    float totalTime = 0.0f;
+
+    // Simple time-based rotation for visual interest
+    scheduler.AddSystem<Nexus::Writes<Nexus::Transform>, Nexus::Reads<Nexus::MeshRenderer>>("RotateMeshes",
+        [&totalTime](Nexus::SystemContext& context)
+        {
+            Nexus::Vector3 angles(totalTime * 0.5f, totalTime, totalTime * 0.3f);
+            context.registry.View<Nexus::Transform, const Nexus::MeshRenderer>().ForEach(
+                [&angles](Nexus::Entity, Nexus::Transform& transform, const Nexus::MeshRenderer&)
+                {
+                    transform.SetEulerAngles(angles);
+                });
+        });
+
+    // World matrices once everything that moves transforms has run (sorting is structural)
+    Nexus::TransformSystem transformSystem;
+    scheduler.AddSystem<Nexus::Exclusive>("PropagateTransforms",
+        [&transformSystem](Nexus::SystemContext& context) { transformSystem.Update(context.registry, context.jobs); });
+
+    // Smoke check: Render groups Transform with MeshRenderer, which the transform system
+    // must work with (it cannot reorder a group-owned storage) on every later frame
+    for (int frame = 0; frame < 2; frame++)
+    {
+        renderSystem.Render(renderRegistry, renderCamera);
+        transformSystem.Update(renderRegistry, jobSystem);
+    }
+    float satelliteWorldX = satellite.GetComponent<Nexus::Transform>().GetWorldMatrix()[12];
+    NEXUS_CORE_INFO("Satellite world X after render + propagate: " + std::to_string(satelliteWorldX) + " (should be 2.000000)");
+
     NEXUS_CORE_INFO("Window created successfully - Your cube should be visible!");
     NEXUS_CORE_INFO("Controls: ESC or close window to exit");
 
     // Main rendering loop
+    uint64_t frameCount = 0;
     while (!window.ShouldClose())
     {
         window.Update();
 
-        // Simple time-based rotation for visual interest
-        static float totalTime = 0.0f;
         totalTime += 0.016f; // Approximate 60 FPS
 
-        // Apply rotation to the cube transform
-        cubeTransform.SetEulerAngles(Nexus::Vector3(totalTime * 0.5f, totalTime, totalTime * 0.3f));
+        scheduler.Run(renderRegistry, jobSystem);
+
+        // Periodic memory report (about every 10 seconds)
+        if (++frameCount % 600 == 0)
+            renderRegistry.LogMemoryStats();
 
         // Render all ECS entities (RenderSystem will handle clearing)
         renderSystem.Render(renderRegistry, renderCamera);
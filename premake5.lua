@@ -1,6 +1,7 @@
 -- NexusEngine Root Build Configuration
 -- Session 003 - Added Math, Input, and Renderer modules
 -- Session 004 - Added Scene/ECS module
+-- Session 005 - Added Benchmarks application
 
 workspace "NexusEngine"
     architecture "x64"
@@ -353,6 +354,50 @@ project "Runtime"
         "Scene"
     }
 
+    filter "system:windows"
+        systemversion "latest"
+        defines "NEXUS_PLATFORM_WINDOWS"
+
+    filter "configurations:Debug"
+        defines "NEXUS_DEBUG"
+        symbols "on"
+
+    filter "configurations:Release"
+        defines "NEXUS_RELEASE"
+        optimize "on"
+
+-- Benchmarks Application
+project "Benchmarks"
+    location "Benchmarks"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "off"
+
+    targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+    objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "%{prj.location}/Include/**.h",
+        "%{prj.location}/Source/**.cpp"
+    }
+
+    includedirs
+    {
+        "%{prj.location}/Include",
+        "Engine/Core/Include",
+        "Engine/Math/Include",
+        "Engine/Scene/Include"
+    }
+
+    links
+    {
+        "Core",
+        "Math",
+        "Scene"
+    }
+
     filter "system:windows"
         systemversion "latest"
         defines "NEXUS_PLATFORM_WINDOWS"